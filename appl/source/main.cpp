@@ -19,13 +19,16 @@
 /* Local */
 #include "gpio.hpp"
 #include "rcc.hpp"
+#include "timebase.hpp"
 
 using namespace bmpp::hal;
 
 int main() {
 
-    /* Set clock 48Mhz */
-    rcc.set_clock(48'000'000UL);
+    /* Set clock 72Mhz */
+    rcc.set_clock<72'000'000UL>();
+    /* Start 1 ms time base */
+    timebase.start();
     /* Initialize gpio port A */
     gpio_a.initialize();
     /* Get pin 5 op gpio port A */
@@ -37,17 +40,13 @@ int main() {
 
         /* Set pin high. */
         pin.set(Pin::State::high);
-        /* Wait X */
-        for(volatile uint32_t i = 0; i < 100000; i++) {
-            // Wait a bit.
-        }
+        /* Wait 500 ms */
+        timebase.delay(500UL);
         /* Set pin low. */
         pin.set(Pin::State::low);
 
-        /* Wait X */
-        for(volatile uint32_t i = 0; i < 100000; i++) {
-            // Wait a bit.
-        }
+        /* Wait 500 ms */
+        timebase.delay(500UL);
     }
 
     return 0;
@@ -0,0 +1,42 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    fastcode.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Placement of hot functions in RAM.
+ */
+
+#ifndef BMPP_HAL_FASTCODE_HPP__
+#define BMPP_HAL_FASTCODE_HPP__
+
+/* System. */
+
+/* Third-party. */
+
+
+/* Local. */
+
+/**
+ *  Places a function in the .fastcode section, which the startup code copies
+ *  from flash to RAM, so it executes without flash wait states.
+ *  The function is never inlined into flash resident callers, and is called
+ *  through a long call as RAM is out of range of a direct branch from flash.
+ *  Callees are only executed from RAM when they are inlined or marked as
+ *  well. Without FASTCODE, e.g. on the host, the attribute has no effect.
+ *
+ *  Usage:
+ *      BMPP_FASTCODE void filter(const uint32_t& sample);
+ *      BMPP_FASTCODE void tim2_handler();
+ */
+#if defined(FASTCODE) && (FASTCODE != 0)
+#define BMPP_FASTCODE [[gnu::section(".fastcode"), gnu::long_call, gnu::noinline]]
+#else
+#define BMPP_FASTCODE
+#endif
+
+#endif /* BMPP_HAL_FASTCODE_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
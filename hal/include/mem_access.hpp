@@ -19,6 +19,11 @@
 
 
 /* Local. */
+#if defined(HOST)
+#include "register_file.hpp" /* Simulated register file.      */
+#elif defined(CORTEX_M3)
+#include "bit_band.hpp"      /* Bit-band alias access.        */
+#endif
 
 namespace bmpp {
 
@@ -33,6 +38,54 @@ enum class Access_policy {
     read_write  /**< Read and write access. */
 };
 
+/**
+ *  Storage backend which maps register addresses directly onto the memory bus.
+ */
+struct Direct_storage {
+
+    /**
+     *  Maps a register address onto a pointer.
+     *  @param[in] address   Integer representative of the Memory address.
+     *  @return              Pointer to IO Memory.
+     */
+    static inline volatile uint32_t* map(const uint32_t& address) {
+        return reinterpret_cast<volatile uint32_t *>(address);
+    }
+
+    /**
+     *  Reads a single bit.
+     *  @param[in] address   Address of the word.
+     *  @param[in] bit       Bit position within the word.
+     *  @return              State of the bit.
+     */
+    static inline bool read_bit(const uint32_t& address, const uint32_t& bit) {
+        return (((*map(address)) >> bit) & 1UL);
+    }
+
+    /**
+     *  Writes a single bit through a read-modify-write of the word.
+     *  @param[in] address   Address of the word.
+     *  @param[in] bit       Bit position within the word.
+     *  @param[in] value     State to write.
+     *  @return None.
+     */
+    static inline void write_bit(const uint32_t& address, const uint32_t& bit, const bool& value) {
+        if(value) {
+            *map(address) |= (1UL << bit);
+        } else {
+            *map(address) &= ~(1UL << bit);
+        }
+    }
+};
+
+#if defined(HOST)
+using Default_storage = host::Register_file;    /**< Simulated registers on the host. */
+#elif defined(CORTEX_M3)
+using Default_storage = cortex_m3::Bit_band_storage; /**< Registers with bit-band access. */
+#else
+using Default_storage = Direct_storage;         /**< Registers on the memory bus.     */
+#endif
+
 /**
  * Writes a binary value masked by a given field and position.
  * @param[in] lhs   Left hand value.
@@ -114,8 +167,9 @@ private:
 /**
  *  wrapper class for staticaly mapped Memory access.
  *  @tparam  Policy  Access policy.
+ *  @tparam  Storage Backend mapping the address onto storage.
  */
-template<Access_policy Policy>
+template<Access_policy Policy, class Storage = Default_storage>
 class Memory_register {
 public:
 
@@ -466,6 +520,14 @@ public:
         return get_reference();
     }
 
+    /**
+     *  Address of the register.
+     *  @return         Integer representative of the Memory address.
+     */
+    constexpr uint32_t get_address() const {
+        return address;
+    }
+
 private:
 
     uint32_t address;   /**< Memory address which the object wraps. */
@@ -483,6 +545,68 @@ private:
     inline volatile uint32_t& get_reference() const;
 };
 
+/**
+ *  Single bit of a memory register.
+ *  Writes are a single store where the storage supports bit-band aliasing.
+ *  @tparam  Policy  Access policy.
+ *  @tparam  Storage Backend mapping the address onto storage.
+ */
+template<Access_policy Policy, class Storage = Default_storage>
+class Memory_bit {
+public:
+
+    /**
+     *  Constructor from address and bit position.
+     *  @param[in] address   Integer representative of the Memory address.
+     *  @param[in] bit       Position of the bit within the word.
+     */
+    constexpr Memory_bit(const uint32_t& address, const uint32_t& bit);
+
+    /**
+     *  Constructor from a register and bit position.
+     *  @param[in] reg       Register containing the bit.
+     *  @param[in] bit       Position of the bit within the register.
+     */
+    constexpr Memory_bit(const Memory_register<Policy, Storage>& reg, const uint32_t& bit);
+
+    /**
+     *  Assignment operator.
+     *  @param[in]  value   State of the bit.
+     *  @return             Reference to lefthand value.
+     */
+    inline const Memory_bit& operator=(const bool& value) const;
+
+    /**
+     *  Sets the bit.
+     *  @return None.
+     */
+    inline void set() const;
+
+    /**
+     *  Clears the bit.
+     *  @return None.
+     */
+    inline void clear() const;
+
+    /**
+     *  Reads the bit.
+     *  @return State of the bit.
+     */
+    inline bool get() const;
+
+    /**
+     *  Implicit conversion to boolean.
+     *  @return State of the bit.
+     */
+    inline operator bool() const;
+
+private:
+
+    uint32_t address;   /**< Address of the word containing the bit. */
+    uint32_t bit;       /**< Position of the bit.                    */
+
+};
+
 /******************************************************************************/
 /* Definitions.                                                               */
 /******************************************************************************/
@@ -582,243 +706,291 @@ constexpr typename Array_wrapper<T>::size_type Array_wrapper<T>::max_size() cons
 /* Class Memory_register                                                      */
 /*----------------------------------------------------------------------------*/
 
-template<Access_policy P>
-constexpr Memory_register<P>::Memory_register(uint32_t address)
+template<Access_policy P, class S>
+constexpr Memory_register<P, S>::Memory_register(uint32_t address)
     : address { address } {
 
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-const Memory_register<P>& Memory_register<P>::operator=(const T& rhs) const {
+const Memory_register<P, S>& Memory_register<P, S>::operator=(const T& rhs) const {
     get_reference() = rhs;
     return *this;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline const Memory_register<P>& Memory_register<P>::operator+=(const T& rhs) const {
+inline const Memory_register<P, S>& Memory_register<P, S>::operator+=(const T& rhs) const {
     get_reference() += rhs;
     return *this;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline const Memory_register<P>& Memory_register<P>::operator-=(const T& rhs) const {
+inline const Memory_register<P, S>& Memory_register<P, S>::operator-=(const T& rhs) const {
     get_reference() -= rhs;
     return *this;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline const Memory_register<P>& Memory_register<P>::operator*=(const T& rhs) const {
+inline const Memory_register<P, S>& Memory_register<P, S>::operator*=(const T& rhs) const {
     get_reference() *= rhs;
     return *this;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline const Memory_register<P>& Memory_register<P>::operator/=(const T& rhs) const {
+inline const Memory_register<P, S>& Memory_register<P, S>::operator/=(const T& rhs) const {
     get_reference() /= rhs;
     return *this;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline const Memory_register<P>& Memory_register<P>::operator%=(const T& rhs) const {
+inline const Memory_register<P, S>& Memory_register<P, S>::operator%=(const T& rhs) const {
     get_reference() %= rhs;
     return *this;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline const Memory_register<P>& Memory_register<P>::operator&=(const T& rhs) const {
+inline const Memory_register<P, S>& Memory_register<P, S>::operator&=(const T& rhs) const {
     get_reference() &= rhs;
     return *this;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline const Memory_register<P>& Memory_register<P>::operator|=(const T& rhs) const {
+inline const Memory_register<P, S>& Memory_register<P, S>::operator|=(const T& rhs) const {
     get_reference() |= rhs;
     return *this;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline const Memory_register<P>& Memory_register<P>::operator^=(const T& rhs) const {
+inline const Memory_register<P, S>& Memory_register<P, S>::operator^=(const T& rhs) const {
     get_reference() ^= rhs;
     return *this;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline const Memory_register<P>& Memory_register<P>::operator<<=(const T& rhs) const {
+inline const Memory_register<P, S>& Memory_register<P, S>::operator<<=(const T& rhs) const {
     get_reference() <<= rhs;
     return *this;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline const Memory_register<P>& Memory_register<P>::operator>>=(const T& rhs) const {
+inline const Memory_register<P, S>& Memory_register<P, S>::operator>>=(const T& rhs) const {
     get_reference() >>= rhs;
     return *this;
 }
 
-template<Access_policy P>
-inline const Memory_register<P>& Memory_register<P>::operator++() const {
+template<Access_policy P, class S>
+inline const Memory_register<P, S>& Memory_register<P, S>::operator++() const {
     get_reference() += 1;
     return *this;
 }
 
-template<Access_policy P>
-inline const Memory_register<P>& Memory_register<P>::operator--() const {
+template<Access_policy P, class S>
+inline const Memory_register<P, S>& Memory_register<P, S>::operator--() const {
     get_reference() -= 1;
     return *this;
 }
 
-template<Access_policy P>
-inline uint32_t Memory_register<P>::operator++(int) const {
+template<Access_policy P, class S>
+inline uint32_t Memory_register<P, S>::operator++(int) const {
     uint32_t temp = get_reference();
     get_reference() += 1;
     return temp;
 }
 
-template<Access_policy P>
-inline uint32_t Memory_register<P>::operator--(int) const {
+template<Access_policy P, class S>
+inline uint32_t Memory_register<P, S>::operator--(int) const {
     uint32_t temp = get_reference();
     get_reference() -= 1;
     return temp;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline uint32_t Memory_register<P>::operator+(const T& rhs) const {
+inline uint32_t Memory_register<P, S>::operator+(const T& rhs) const {
     return get_reference() + rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline uint32_t Memory_register<P>::operator-(const T& rhs) const {
+inline uint32_t Memory_register<P, S>::operator-(const T& rhs) const {
     return get_reference() - rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline uint32_t Memory_register<P>::operator*(const T& rhs) const {
+inline uint32_t Memory_register<P, S>::operator*(const T& rhs) const {
     return get_reference() * rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline uint32_t Memory_register<P>::operator/(const T& rhs) const {
+inline uint32_t Memory_register<P, S>::operator/(const T& rhs) const {
     return get_reference() / rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline uint32_t Memory_register<P>::operator%(const T& rhs) const {
+inline uint32_t Memory_register<P, S>::operator%(const T& rhs) const {
     return get_reference() % rhs;
 }
 
-template<Access_policy P>
-inline uint32_t Memory_register<P>::operator~() const {
+template<Access_policy P, class S>
+inline uint32_t Memory_register<P, S>::operator~() const {
     return ~get_reference();
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline uint32_t Memory_register<P>::operator&(const T& rhs) const {
+inline uint32_t Memory_register<P, S>::operator&(const T& rhs) const {
     return get_reference() & rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline uint32_t Memory_register<P>::operator|(const T& rhs) const {
+inline uint32_t Memory_register<P, S>::operator|(const T& rhs) const {
     return get_reference() | rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline uint32_t Memory_register<P>::operator^(const T& rhs) const {
+inline uint32_t Memory_register<P, S>::operator^(const T& rhs) const {
     return get_reference() ^ rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline uint32_t Memory_register<P>::operator<<(const T& rhs) const {
+inline uint32_t Memory_register<P, S>::operator<<(const T& rhs) const {
     return get_reference() << rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline uint32_t Memory_register<P>::operator>>(const T& rhs) const {
+inline uint32_t Memory_register<P, S>::operator>>(const T& rhs) const {
     return get_reference() >> rhs;
 }
 
-template<Access_policy P>
-inline bool Memory_register<P>::operator!() const {
+template<Access_policy P, class S>
+inline bool Memory_register<P, S>::operator!() const {
     return !get_reference();
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline bool Memory_register<P>::operator&&(const T& rhs) const {
+inline bool Memory_register<P, S>::operator&&(const T& rhs) const {
     return get_reference() && rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline bool Memory_register<P>::operator||(const T& rhs) const {
+inline bool Memory_register<P, S>::operator||(const T& rhs) const {
     return get_reference() || rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline bool Memory_register<P>::operator==(const T& rhs) const {
+inline bool Memory_register<P, S>::operator==(const T& rhs) const {
     return get_reference() == rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline bool Memory_register<P>::operator!=(const T& rhs) const {
+inline bool Memory_register<P, S>::operator!=(const T& rhs) const {
     return get_reference() != rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline bool Memory_register<P>::operator<(const T& rhs) const {
+inline bool Memory_register<P, S>::operator<(const T& rhs) const {
     return get_reference() < rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline bool Memory_register<P>::operator>(const T& rhs) const {
+inline bool Memory_register<P, S>::operator>(const T& rhs) const {
     return get_reference() > rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline bool Memory_register<P>::operator<=(const T& rhs) const {
+inline bool Memory_register<P, S>::operator<=(const T& rhs) const {
     return get_reference() <= rhs;
 }
 
-template<Access_policy P>
+template<Access_policy P, class S>
 template<typename T>
-inline bool Memory_register<P>::operator>=(const T& rhs) const {
+inline bool Memory_register<P, S>::operator>=(const T& rhs) const {
     return get_reference() >= rhs;
 }
 
-template<Access_policy P>
-inline volatile uint32_t* Memory_register<P>::get_pointer() const {
-    return reinterpret_cast<volatile uint32_t *>(address);
+template<Access_policy P, class S>
+inline volatile uint32_t* Memory_register<P, S>::get_pointer() const {
+    return S::map(address);
 }
 
-template<Access_policy P>
-inline volatile uint32_t& Memory_register<P>::get_reference() const {
+template<Access_policy P, class S>
+inline volatile uint32_t& Memory_register<P, S>::get_reference() const {
     return *get_pointer();
 }
 
+/*----------------------------------------------------------------------------*/
+/* Class Memory_bit                                                           */
+/*----------------------------------------------------------------------------*/
+
+template<Access_policy P, class S>
+constexpr Memory_bit<P, S>::Memory_bit(const uint32_t& address, const uint32_t& bit)
+    : address { address },
+      bit     { bit } {
+
+}
+
+template<Access_policy P, class S>
+constexpr Memory_bit<P, S>::Memory_bit(const Memory_register<P, S>& reg, const uint32_t& bit)
+    : address { reg.get_address() },
+      bit     { bit } {
+
+}
+
+template<Access_policy P, class S>
+inline const Memory_bit<P, S>& Memory_bit<P, S>::operator=(const bool& value) const {
+    static_assert(P != Access_policy::read_only, "Register is read only.");
+    S::write_bit(address, bit, value);
+    return *this;
+}
+
+template<Access_policy P, class S>
+inline void Memory_bit<P, S>::set() const {
+    static_assert(P != Access_policy::read_only, "Register is read only.");
+    S::write_bit(address, bit, true);
+}
+
+template<Access_policy P, class S>
+inline void Memory_bit<P, S>::clear() const {
+    static_assert(P != Access_policy::read_only, "Register is read only.");
+    S::write_bit(address, bit, false);
+}
+
+template<Access_policy P, class S>
+inline bool Memory_bit<P, S>::get() const {
+    static_assert(P != Access_policy::write_only, "Register is write only.");
+    return S::read_bit(address, bit);
+}
+
+template<Access_policy P, class S>
+inline Memory_bit<P, S>::operator bool() const {
+    return get();
+}
+
 } /* namespace hal */
 
 } /* namespace bmpp */
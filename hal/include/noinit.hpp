@@ -0,0 +1,67 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    noinit.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Placement of objects in RAM skipped by startup initialization.
+ */
+
+#ifndef BMPP_HAL_NOINIT_HPP__
+#define BMPP_HAL_NOINIT_HPP__
+
+/* System. */
+
+/* Third-party. */
+
+
+/* Local. */
+
+/**
+ *  Places an object in the .noinit section, which the startup code never
+ *  touches. Its contents are undefined until written, which saves clearing
+ *  buffers that are overwritten anyway. The object must not have an
+ *  initializer.
+ *
+ *  Usage:
+ *      BMPP_NOINIT uint8_t rx_buffer[1024];
+ */
+#if defined(ARM)
+#define BMPP_NOINIT [[gnu::section(".noinit")]]
+#else
+#define BMPP_NOINIT
+#endif
+
+/**
+ *  Places an object in the .preserved section, which the startup code
+ *  clears on a cold start only. After a warm start, e.g. a software or
+ *  watchdog reset, the object keeps its contents. The object must not have
+ *  an initializer.
+ *
+ *  The section sits at the top of RAM, so it survives firmware updates that
+ *  change other sections. Its size is set per executable by the
+ *  STM32F10xxx_PRESERVED_SIZE property, by default it only holds its check
+ *  word. Define BMPP_PRESERVED_VERSION anew when the preserved objects
+ *  change, so their old contents are cleared instead of misread.
+ *
+ *  Usage:
+ *      BMPP_PRESERVED uint32_t boot_count;
+ */
+#if defined(ARM)
+#define BMPP_PRESERVED [[gnu::section(".preserved")]]
+#else
+#define BMPP_PRESERVED
+#endif
+
+/**
+ *  Layout version of the .preserved section.
+ */
+#if !defined(BMPP_PRESERVED_VERSION)
+#define BMPP_PRESERVED_VERSION 1UL
+#endif
+
+#endif /* BMPP_HAL_NOINIT_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,276 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    pin_group.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Group of compile-time pins spanning multiple pinsets.
+ */
+
+#ifndef BMPP_HAL_PIN_GROUP_HPP__
+#define BMPP_HAL_PIN_GROUP_HPP__
+
+/* System. */
+#include <cstdint>          /* Fixed size integers.     */
+#include <tuple>            /* Tuple element.           */
+#include <utility>          /* Index sequence.          */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "pinset_base.hpp"          /* Pin interface.               */
+#include "register_transaction.hpp" /* Coalesced register updates.  */
+
+namespace bmpp {
+
+namespace hal {
+
+/**
+ *  Group of pins operated on as a whole.
+ *  The pins are Static_pin_base types of any pinsets. Masks per pinset are
+ *  computed at compile time, so every operation accesses each pinset
+ *  involved once. Bit n of a group value corresponds to the n-th pin.
+ *  @tparam Pins    Pins in the group.
+ */
+template<class... Pins>
+class Pin_group {
+public:
+
+    static_assert(sizeof...(Pins) > 0UL, "Empty pin group.");
+    static_assert(sizeof...(Pins) <= 32UL, "Pin group exceeds 32 pins.");
+
+    using First  = typename std::tuple_element<0, std::tuple<Pins...>>::type;
+    using Config = typename First::Config;  /**< Pin configurations. */
+
+    /**
+     *  Configures all pins, with one update per configuration register.
+     *  @param[in]  config  Configuration to be set for the pins.
+     *  @return None.
+     */
+    static void config(const Config& config);
+
+    /**
+     *  Sets all pins high.
+     *  @return None.
+     */
+    static void set();
+
+    /**
+     *  Sets all pins low.
+     *  @return None.
+     */
+    static void clear();
+
+    /**
+     *  Inverts the output state of all pins.
+     *  @return None.
+     */
+    static void toggle();
+
+    /**
+     *  Sets every pin to the corresponding bit of a value.
+     *  @param[in]  value   Bit n is the state of the n-th pin.
+     *  @return None.
+     */
+    static void write(const uint32_t& value);
+
+    /**
+     *  Reads the state of all pins.
+     *  @return Bit n is the state of the n-th pin.
+     */
+    static uint32_t read();
+
+    /**
+     *  Number of pins in the group.
+     *  @return Number of pins.
+     */
+    static constexpr std::size_t size();
+
+private:
+
+    using Indices = std::index_sequence_for<Pins...>;
+
+    static constexpr uint32_t address(const std::size_t& index);
+    static constexpr uint32_t number(const std::size_t& index);
+
+    /**
+     *  Index of the first pin sharing the pinset of a pin.
+     *  @param[in]  index   Index of the pin.
+     *  @return             Index of the first pin of the pinset.
+     */
+    static constexpr std::size_t first(const std::size_t& index);
+
+    /**
+     *  Mask of all pins of the group sharing the pinset of a pin.
+     *  @param[in]  index   Index of the pin.
+     *  @return             Bitmask within the pinset.
+     */
+    static constexpr uint32_t port_mask(const std::size_t& index);
+
+    /**
+     *  Mask of the pins sharing the pinset of a pin which are set in a value.
+     *  @tparam     Index   Index of the pin.
+     *  @param[in]  value   Group value.
+     *  @return             Bitmask within the pinset.
+     */
+    template<std::size_t Index, std::size_t... I>
+    static uint32_t port_bits(const uint32_t& value, std::index_sequence<I...>);
+
+    template<std::size_t N, std::size_t... I>
+    static void config_ports(Register_transaction<N>& transaction, const Config& config, std::index_sequence<I...>);
+
+    template<std::size_t... I>
+    static void set(std::index_sequence<I...>);
+
+    template<std::size_t... I>
+    static void clear(std::index_sequence<I...>);
+
+    template<std::size_t... I>
+    static void toggle(std::index_sequence<I...>);
+
+    template<std::size_t... I>
+    static void write(const uint32_t& value, std::index_sequence<I...>);
+
+    template<std::size_t... I>
+    static uint32_t read(std::index_sequence<I...>);
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+template<class... P>
+void Pin_group<P...>::config(const Config& config) {
+    Register_transaction<(2UL * sizeof...(P))> transaction;
+    config_ports(transaction, config, Indices());
+    transaction.commit();
+}
+
+template<class... P>
+void Pin_group<P...>::set() {
+    set(Indices());
+}
+
+template<class... P>
+void Pin_group<P...>::clear() {
+    clear(Indices());
+}
+
+template<class... P>
+void Pin_group<P...>::toggle() {
+    toggle(Indices());
+}
+
+template<class... P>
+void Pin_group<P...>::write(const uint32_t& value) {
+    write(value, Indices());
+}
+
+template<class... P>
+uint32_t Pin_group<P...>::read() {
+    return read(Indices());
+}
+
+template<class... P>
+constexpr std::size_t Pin_group<P...>::size() {
+    return sizeof...(P);
+}
+
+template<class... P>
+constexpr uint32_t Pin_group<P...>::address(const std::size_t& index) {
+    const uint32_t addresses[] = { P::address()... };
+    return addresses[index];
+}
+
+template<class... P>
+constexpr uint32_t Pin_group<P...>::number(const std::size_t& index) {
+    const uint32_t numbers[] = { P::number()... };
+    return numbers[index];
+}
+
+template<class... P>
+constexpr std::size_t Pin_group<P...>::first(const std::size_t& index) {
+    std::size_t i = 0UL;
+    while(address(i) != address(index)) {
+        i++;
+    }
+    return i;
+}
+
+template<class... P>
+constexpr uint32_t Pin_group<P...>::port_mask(const std::size_t& index) {
+    uint32_t mask = 0UL;
+    for(std::size_t i = 0UL; i < sizeof...(P); i++) {
+        if(address(i) == address(index)) {
+            mask |= (1UL << number(i));
+        }
+    }
+    return mask;
+}
+
+template<class... P>
+template<std::size_t Index, std::size_t... I>
+uint32_t Pin_group<P...>::port_bits(const uint32_t& value, std::index_sequence<I...>) {
+    uint32_t mask = 0UL;
+    const int expand[] = { 0, ((address(I) == address(Index)) ? (mask |= (((value >> I) & 1UL) << number(I)), 0) : 0)... };
+    (void) expand;
+    return mask;
+}
+
+template<class... P>
+template<std::size_t N, std::size_t... I>
+void Pin_group<P...>::config_ports(Register_transaction<N>& transaction, const Config& config, std::index_sequence<I...>) {
+    const int expand[] = { 0, ((first(I) == I) ? (P::get_pinset().config_pins(transaction, port_mask(I), config), 0) : 0)... };
+    (void) expand;
+}
+
+template<class... P>
+template<std::size_t... I>
+void Pin_group<P...>::set(std::index_sequence<I...>) {
+    const int expand[] = { 0, ((first(I) == I) ? (P::get_pinset().set_pins(port_mask(I)), 0) : 0)... };
+    (void) expand;
+}
+
+template<class... P>
+template<std::size_t... I>
+void Pin_group<P...>::clear(std::index_sequence<I...>) {
+    const int expand[] = { 0, ((first(I) == I) ? (P::get_pinset().clear_pins(port_mask(I)), 0) : 0)... };
+    (void) expand;
+}
+
+template<class... P>
+template<std::size_t... I>
+void Pin_group<P...>::toggle(std::index_sequence<I...>) {
+    const int expand[] = { 0, ((first(I) == I) ? (P::get_pinset().toggle_pins(port_mask(I)), 0) : 0)... };
+    (void) expand;
+}
+
+template<class... P>
+template<std::size_t... I>
+void Pin_group<P...>::write(const uint32_t& value, std::index_sequence<I...>) {
+    const int expand[] = { 0, ((first(I) == I) ? (P::get_pinset().write_pins(port_bits<I>(value, Indices()), (port_mask(I) & ~port_bits<I>(value, Indices()))), 0) : 0)... };
+    (void) expand;
+}
+
+template<class... P>
+template<std::size_t... I>
+uint32_t Pin_group<P...>::read(std::index_sequence<I...>) {
+    /* Read every pinset once, in order of first appearance. */
+    const uint32_t ports[] = { ((first(I) == I) ? P::get_pinset().read_pins() : static_cast<uint32_t>(0UL))... };
+    uint32_t value = 0UL;
+    const int expand[] = { 0, (value |= (((ports[first(I)] >> number(I)) & 1UL) << I), 0)... };
+    (void) expand;
+    return value;
+}
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_PIN_GROUP_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
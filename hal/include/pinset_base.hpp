@@ -17,7 +17,7 @@
 
 
 /* Local. */
-
+#include "register_transaction.hpp" /* Coalesced register updates. */
 
 namespace bmpp {
 
@@ -35,11 +35,13 @@ public:
      *  Pin configurations.
      */
     enum class Config {
-        input_floating,     /**< Input pin without pull-up/-down.   */
-        input_analog,       /**< Analog input.                      */
-        input_pull,         /**< Input with pull-up/-down           */
-        output_pushpull,    /**< Output pin pull/push driven.       */
-        output_opendrain    /**< Output pin opendrain driven.       */
+        input_floating,         /**< Input pin without pull-up/-down.       */
+        input_analog,           /**< Analog input.                          */
+        input_pull,             /**< Input with pull-up/-down               */
+        output_pushpull,        /**< Output pin pull/push driven.           */
+        output_opendrain,       /**< Output pin opendrain driven.           */
+        alternate_pushpull,     /**< Peripheral output pull/push driven.    */
+        alternate_opendrain     /**< Peripheral output opendrain driven.    */
     };
 
     /**
@@ -65,6 +67,16 @@ public:
      */
     void config(const Config& config) const;
 
+    /**
+     *  Adds the configuration of this pin to a register transaction.
+     *  @tparam     N           Capacity of the transaction.
+     *  @param[in]  transaction Transaction collecting the update.
+     *  @param[in]  config      Configuration to be set for this pin.
+     *  @return None.
+     */
+    template<std::size_t N>
+    void config(Register_transaction<N>& transaction, const Config& config) const;
+
     /**
      *  sets the state of the pin.
      *  @param[in]  state   The state to set the pin in.
@@ -72,6 +84,26 @@ public:
      **/
     void set(const State& state) const;
 
+    /**
+     *  Sets the pin high with a single atomic store.
+     *  @return None.
+     */
+    void set() const;
+
+    /**
+     *  Sets the pin low with a single atomic store.
+     *  @return None.
+     */
+    void clear() const;
+
+    /**
+     *  Inverts the output state of the pin, reading the output register
+     *  followed by a single store to the set/reset register. An interrupt
+     *  changing the pin in between is undone, other pins are left alone.
+     *  @return None.
+     */
+    void toggle() const;
+
     /**
      *  returns the current state of the pin.
      *  @return The pin state.
@@ -85,6 +117,98 @@ private:
 
 };
 
+/**
+ *  Pin with pinset and number fixed at compile time.
+ *  Holds no storage, all accesses resolve to immediate addresses.
+ *  @tparam Pinset_impl Implementation of the pinset this pin belongs to.
+ *  @tparam Address     Base address of the pinset.
+ *  @tparam Pin_nr      The pin number which this pin is in the set.
+ */
+template<class Pinset_impl, uint32_t Address, uint8_t Pin_nr>
+class Static_pin_base {
+public:
+
+    static_assert(Pin_nr < 32U, "Pin number exceeds pinset.");
+
+    using Config = typename Pin_base<Pinset_impl>::Config;  /**< Pin configurations. */
+    using State  = typename Pin_base<Pinset_impl>::State;   /**< Pin state.          */
+
+    /**
+     *  Configures pin for given configuration.
+     *  @param[in]  config  Configuration to be set for this pin.
+     *  @return None.
+     */
+    static void config(const Config& config);
+
+    /**
+     *  sets the state of the pin.
+     *  @param[in]  state   The state to set the pin in.
+     *  @return None.
+     **/
+    static void set(const State& state);
+
+    /**
+     *  Sets the pin high with a single atomic store.
+     *  @return None.
+     */
+    static void set();
+
+    /**
+     *  Sets the pin low with a single atomic store.
+     *  @return None.
+     */
+    static void clear();
+
+    /**
+     *  Inverts the output state of the pin, reading the output register
+     *  followed by a single store to the set/reset register. An interrupt
+     *  changing the pin in between is undone, other pins are left alone.
+     *  @return None.
+     */
+    static void toggle();
+
+    /**
+     *  returns the current state of the pin.
+     *  @return The pin state.
+     */
+    static State get();
+
+    /**
+     *  Mask of the pin within its pinset.
+     *  @return Bitmask.
+     */
+    static constexpr uint32_t mask();
+
+    /**
+     *  Pin number within its pinset.
+     *  @return Pin number.
+     */
+    static constexpr uint8_t number();
+
+    /**
+     *  Base address of the pinset.
+     *  @return Address.
+     */
+    static constexpr uint32_t address();
+
+    /**
+     *  Pinset this pin belongs to.
+     *  @return Reference to the pinset.
+     */
+    static constexpr const Pinset_impl& get_pinset();
+
+    /**
+     *  Conversion to a runtime pin.
+     *  @return Pin object referring to the same pin.
+     */
+    constexpr operator Pin_base<Pinset_impl>() const;
+
+private:
+
+    static constexpr Pinset_impl pinset { Address };    /**< Pinset of the pin. */
+
+};
+
 /**
  *  Base class for a pinset.
  *  @tparam Pinset_impl implementation of the pinset.
@@ -104,6 +228,63 @@ public:
      */
     void initialize() const;
 
+    /**
+     *  Configures multiple pins with a single update per configuration register.
+     *  @param[in]  pins    Mask of the pins to configure.
+     *  @param[in]  config  Configuration to be set for the pins.
+     *  @return None.
+     */
+    void config(const uint32_t& pins, const typename Pin::Config& config) const;
+
+    /**
+     *  Adds the configuration of multiple pins to a register transaction.
+     *  @tparam     N           Capacity of the transaction.
+     *  @param[in]  transaction Transaction collecting the update.
+     *  @param[in]  pins        Mask of the pins to configure.
+     *  @param[in]  config      Configuration to be set for the pins.
+     *  @return None.
+     */
+    template<std::size_t N>
+    void config(Register_transaction<N>& transaction, const uint32_t& pins, const typename Pin::Config& config) const;
+
+    /**
+     *  Sets multiple pins high with a single atomic store.
+     *  @param[in]  pins    Mask of the pins to set.
+     *  @return None.
+     */
+    void set(const uint32_t& pins) const;
+
+    /**
+     *  Sets multiple pins low with a single atomic store.
+     *  @param[in]  pins    Mask of the pins to clear.
+     *  @return None.
+     */
+    void clear(const uint32_t& pins) const;
+
+    /**
+     *  Inverts the output state of multiple pins, reading the output
+     *  register followed by a single store to the set/reset register. An
+     *  interrupt changing the same pins in between is undone.
+     *  @param[in]  pins    Mask of the pins to toggle.
+     *  @return None.
+     */
+    void toggle(const uint32_t& pins) const;
+
+    /**
+     *  Sets and clears multiple pins with a single atomic store.
+     *  Pins present in both masks are set.
+     *  @param[in]  set_mask    Mask of the pins to set.
+     *  @param[in]  clear_mask  Mask of the pins to clear.
+     *  @return None.
+     */
+    void write(const uint32_t& set_mask, const uint32_t& clear_mask) const;
+
+    /**
+     *  returns the input state of all pins.
+     *  @return Mask of the pins which are high.
+     */
+    uint32_t read() const;
+
     /**
      *  returns a pin object for a given pin number.
      *  @param[in]  pin Number of the pin to return.
@@ -146,16 +327,99 @@ void Pin_base<T>::config(const Config& config) const {
     pinset.config_pin(pin_nr, config);
 }
 
+template<class T>
+template<std::size_t N>
+void Pin_base<T>::config(Register_transaction<N>& transaction, const Config& config) const {
+    pinset.config_pin(transaction, pin_nr, config);
+}
+
 template<class T>
 void Pin_base<T>::set(const State& state) const {
     pinset.set_pin_state(pin_nr, state);
 }
 
+template<class T>
+void Pin_base<T>::set() const {
+    pinset.set_pins(1UL << pin_nr);
+}
+
+template<class T>
+void Pin_base<T>::clear() const {
+    pinset.clear_pins(1UL << pin_nr);
+}
+
+template<class T>
+void Pin_base<T>::toggle() const {
+    pinset.toggle_pins(1UL << pin_nr);
+}
+
 template<class T>
 typename Pin_base<T>::State Pin_base<T>::get() const {
     return pinset.get_pin_state(pin_nr);
 }
 
+/*----------------------------------------------------------------------------*/
+/* Class Static_pin_base                                                      */
+/*----------------------------------------------------------------------------*/
+
+template<class T, uint32_t A, uint8_t N>
+constexpr T Static_pin_base<T, A, N>::pinset;
+
+template<class T, uint32_t A, uint8_t N>
+void Static_pin_base<T, A, N>::config(const Config& config) {
+    pinset.config_pin(N, config);
+}
+
+template<class T, uint32_t A, uint8_t N>
+void Static_pin_base<T, A, N>::set(const State& state) {
+    pinset.set_pin_state(N, state);
+}
+
+template<class T, uint32_t A, uint8_t N>
+void Static_pin_base<T, A, N>::set() {
+    pinset.set_pins(mask());
+}
+
+template<class T, uint32_t A, uint8_t N>
+void Static_pin_base<T, A, N>::clear() {
+    pinset.clear_pins(mask());
+}
+
+template<class T, uint32_t A, uint8_t N>
+void Static_pin_base<T, A, N>::toggle() {
+    pinset.toggle_pins(mask());
+}
+
+template<class T, uint32_t A, uint8_t N>
+typename Static_pin_base<T, A, N>::State Static_pin_base<T, A, N>::get() {
+    return pinset.get_pin_state(N);
+}
+
+template<class T, uint32_t A, uint8_t N>
+constexpr uint32_t Static_pin_base<T, A, N>::mask() {
+    return (1UL << N);
+}
+
+template<class T, uint32_t A, uint8_t N>
+constexpr uint8_t Static_pin_base<T, A, N>::number() {
+    return N;
+}
+
+template<class T, uint32_t A, uint8_t N>
+constexpr uint32_t Static_pin_base<T, A, N>::address() {
+    return A;
+}
+
+template<class T, uint32_t A, uint8_t N>
+constexpr const T& Static_pin_base<T, A, N>::get_pinset() {
+    return pinset;
+}
+
+template<class T, uint32_t A, uint8_t N>
+constexpr Static_pin_base<T, A, N>::operator Pin_base<T>() const {
+    return Pin_base<T>(pinset, N);
+}
+
 /*----------------------------------------------------------------------------*/
 /* Class Pinset                                                               */
 /*----------------------------------------------------------------------------*/
@@ -165,6 +429,42 @@ void Pinset_base<T>::initialize() const {
     derived().initialize();
 }
 
+template<class T>
+void Pinset_base<T>::config(const uint32_t& pins, const typename Pin::Config& config) const {
+    derived().config_pins(pins, config);
+}
+
+template<class T>
+template<std::size_t N>
+void Pinset_base<T>::config(Register_transaction<N>& transaction, const uint32_t& pins, const typename Pin::Config& config) const {
+    derived().config_pins(transaction, pins, config);
+}
+
+template<class T>
+void Pinset_base<T>::set(const uint32_t& pins) const {
+    derived().set_pins(pins);
+}
+
+template<class T>
+void Pinset_base<T>::clear(const uint32_t& pins) const {
+    derived().clear_pins(pins);
+}
+
+template<class T>
+void Pinset_base<T>::toggle(const uint32_t& pins) const {
+    derived().toggle_pins(pins);
+}
+
+template<class T>
+void Pinset_base<T>::write(const uint32_t& set_mask, const uint32_t& clear_mask) const {
+    derived().write_pins(set_mask, clear_mask);
+}
+
+template<class T>
+uint32_t Pinset_base<T>::read() const {
+    return derived().read_pins();
+}
+
 template<class T>
 constexpr Pin_base<T> Pinset_base<T>::get_pin(const uint8_t& pin) const {
     return Pin(derived(), pin);
@@ -0,0 +1,281 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    register_field.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Compile-time bitfield descriptors for memory registers.
+ */
+
+#ifndef BMPP_HAL_REGISTER_FIELD_HPP__
+#define BMPP_HAL_REGISTER_FIELD_HPP__
+
+/* System. */
+#include <cstdint>          /* Fixed size integers.          */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "mem_access.hpp"   /* Mapped memory access.         */
+
+namespace bmpp {
+
+namespace hal {
+
+/**
+ *  Set of field values for a single register layout.
+ *  Values of multiple fields of one register are combined with operator|
+ *  and then applied to the register in a single access.
+ *  @tparam Layout  Register layout the fields belong to.
+ */
+template<class Layout>
+class Field_value {
+public:
+
+    /**
+     *  Constructor.
+     *  @param[in]  mask    Mask of the bits covered by the value.
+     *  @param[in]  bits    Bits to write, already shifted in place.
+     */
+    constexpr Field_value(const uint32_t& mask, const uint32_t& bits);
+
+    /**
+     *  Combines the values of two sets of fields.
+     *  @param[in]  rhs Righthand value.
+     *  @return         Set of fields covering both operands.
+     */
+    constexpr Field_value operator|(const Field_value& rhs) const;
+
+    /**
+     *  Mask of all bits covered by this value.
+     *  @return Bitmask.
+     */
+    constexpr uint32_t mask() const;
+
+    /**
+     *  Bits to write within the mask.
+     *  @return Bit pattern.
+     */
+    constexpr uint32_t bits() const;
+
+    /**
+     *  Applies the value to a register value.
+     *  @param[in]  reg Current register value.
+     *  @return         Register value with the fields overwritten.
+     */
+    constexpr uint32_t apply(const uint32_t reg) const;
+
+private:
+
+    uint32_t mask_; /**< Mask of the bits covered. */
+    uint32_t bits_; /**< Bits within the mask.     */
+
+};
+
+/**
+ *  Describes a bitfield within a register.
+ *  @tparam Layout      Register layout the field belongs to.
+ *  @tparam Position    Position of the least significant bit.
+ *  @tparam Width       Number of bits.
+ *  @tparam Policy      Access policy of the field.
+ *  @tparam T           Value type, integer, bool or enumeration.
+ */
+template<class Layout, uint32_t Position, uint32_t Width,
+         Access_policy Policy = Access_policy::read_write, typename T = uint32_t>
+class Field {
+public:
+
+    static_assert((Width > 0UL) && ((Position + Width) <= 32UL), "Field exceeds register.");
+
+    using layout_type = Layout; /**< Register layout. */
+    using value_type  = T;      /**< Value type.      */
+
+    /**
+     *  Mask of the field in place.
+     *  @return Bitmask.
+     */
+    static constexpr uint32_t mask();
+
+    /**
+     *  Field holding the given value.
+     *  @param[in]  value   Value of the field.
+     *  @return             Field value to be applied to the register.
+     */
+    static constexpr Field_value<Layout> value(const T& value);
+
+    /**
+     *  Field with all bits set.
+     *  @return             Field value to be applied to the register.
+     */
+    static constexpr Field_value<Layout> set();
+
+    /**
+     *  Field with all bits cleared.
+     *  @return             Field value to be applied to the register.
+     */
+    static constexpr Field_value<Layout> clear();
+
+    /**
+     *  Extracts the field from a register value.
+     *  @param[in]  reg     Register value.
+     *  @return             Value of the field.
+     */
+    static constexpr T get(const uint32_t reg);
+
+};
+
+/**
+ *  Memory register with a typed field layout.
+ *  @tparam  Layout  Register layout, fields must be declared with it.
+ *  @tparam  Policy  Access policy.
+ *  @tparam  Storage Backend mapping the address onto storage.
+ */
+template<class Layout, Access_policy Policy = Access_policy::read_write, class Storage = Default_storage>
+class Field_register : public Memory_register<Policy, Storage> {
+public:
+
+    using Memory_register<Policy, Storage>::Memory_register;
+    using Memory_register<Policy, Storage>::operator=;
+
+    /**
+     *  Modifies fields with a single read and a single write.
+     *  @param[in]  values  Combined fields to write.
+     *  @return None.
+     */
+    inline void modify(const Field_value<Layout>& values) const;
+
+    /**
+     *  Writes fields without reading, bits outside the fields are cleared.
+     *  @param[in]  values  Combined fields to write.
+     *  @return None.
+     */
+    inline void write(const Field_value<Layout>& values) const;
+
+    /**
+     *  Reads a single field.
+     *  @tparam     F   Field to read.
+     *  @return         Value of the field.
+     */
+    template<class F>
+    inline typename F::value_type read() const;
+
+    /**
+     *  Checks whether all given fields currently hold their values.
+     *  @param[in]  values  Combined fields to compare.
+     *  @return             True when all fields match.
+     */
+    inline bool matches(const Field_value<Layout>& values) const;
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+/*----------------------------------------------------------------------------*/
+/* Class Field_value                                                          */
+/*----------------------------------------------------------------------------*/
+
+template<class L>
+constexpr Field_value<L>::Field_value(const uint32_t& mask, const uint32_t& bits) :
+    mask_ { mask },
+    bits_ { bits & mask } {
+
+}
+
+template<class L>
+constexpr Field_value<L> Field_value<L>::operator|(const Field_value& rhs) const {
+    return Field_value((mask_ | rhs.mask_), ((bits_ & ~rhs.mask_) | rhs.bits_));
+}
+
+template<class L>
+constexpr uint32_t Field_value<L>::mask() const {
+    return mask_;
+}
+
+template<class L>
+constexpr uint32_t Field_value<L>::bits() const {
+    return bits_;
+}
+
+template<class L>
+constexpr uint32_t Field_value<L>::apply(const uint32_t reg) const {
+    return ((reg & ~mask_) | bits_);
+}
+
+/*----------------------------------------------------------------------------*/
+/* Class Field                                                                */
+/*----------------------------------------------------------------------------*/
+
+template<class L, uint32_t Pos, uint32_t W, Access_policy P, typename T>
+constexpr uint32_t Field<L, Pos, W, P, T>::mask() {
+    return (create_mask(W) << Pos);
+}
+
+template<class L, uint32_t Pos, uint32_t W, Access_policy P, typename T>
+constexpr Field_value<L> Field<L, Pos, W, P, T>::value(const T& value) {
+    static_assert(P != Access_policy::read_only, "Field is read only.");
+    return Field_value<L>(mask(), (static_cast<uint32_t>(value) << Pos));
+}
+
+template<class L, uint32_t Pos, uint32_t W, Access_policy P, typename T>
+constexpr Field_value<L> Field<L, Pos, W, P, T>::set() {
+    static_assert(P != Access_policy::read_only, "Field is read only.");
+    return Field_value<L>(mask(), mask());
+}
+
+template<class L, uint32_t Pos, uint32_t W, Access_policy P, typename T>
+constexpr Field_value<L> Field<L, Pos, W, P, T>::clear() {
+    static_assert(P != Access_policy::read_only, "Field is read only.");
+    return Field_value<L>(mask(), 0UL);
+}
+
+template<class L, uint32_t Pos, uint32_t W, Access_policy P, typename T>
+constexpr T Field<L, Pos, W, P, T>::get(const uint32_t reg) {
+    return static_cast<T>((reg >> Pos) & create_mask(W));
+}
+
+/*----------------------------------------------------------------------------*/
+/* Class Field_register                                                       */
+/*----------------------------------------------------------------------------*/
+
+template<class L, Access_policy P, class S>
+inline void Field_register<L, P, S>::modify(const Field_value<L>& values) const {
+    static_assert(P == Access_policy::read_write, "Register can not be read-modify-written.");
+    volatile uint32_t& reg = *this;
+    reg = values.apply(reg);
+}
+
+template<class L, Access_policy P, class S>
+inline void Field_register<L, P, S>::write(const Field_value<L>& values) const {
+    static_assert(P != Access_policy::read_only, "Register is read only.");
+    volatile uint32_t& reg = *this;
+    reg = values.bits();
+}
+
+template<class L, Access_policy P, class S>
+template<class F>
+inline typename F::value_type Field_register<L, P, S>::read() const {
+    static_assert(P != Access_policy::write_only, "Register is write only.");
+    static_assert(std::is_same<typename F::layout_type, L>::value, "Field belongs to another register.");
+    const volatile uint32_t& reg = *this;
+    return F::get(reg);
+}
+
+template<class L, Access_policy P, class S>
+inline bool Field_register<L, P, S>::matches(const Field_value<L>& values) const {
+    static_assert(P != Access_policy::write_only, "Register is write only.");
+    const volatile uint32_t& reg = *this;
+    return ((reg & values.mask()) == values.bits());
+}
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_REGISTER_FIELD_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
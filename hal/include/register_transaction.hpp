@@ -0,0 +1,204 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    register_transaction.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Coalescing of register updates into a single store per register.
+ */
+
+#ifndef BMPP_HAL_REGISTER_TRANSACTION_HPP__
+#define BMPP_HAL_REGISTER_TRANSACTION_HPP__
+
+/* System. */
+#include <array>            /* Fixed size array.             */
+#include <cstdint>          /* Fixed size integers.          */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "mem_access.hpp"       /* Mapped memory access. */
+#include "register_field.hpp"   /* Register bitfields.   */
+
+namespace bmpp {
+
+namespace hal {
+
+/**
+ *  Collects modifications of one or more registers and commits every
+ *  register with at most one read and exactly one write.
+ *  Registers which are completely overwritten are not read at all.
+ *  When more registers are touched than fit, the pending updates are
+ *  committed first to make room.
+ *  @tparam Capacity    Maximum number of distinct registers pending.
+ */
+template<std::size_t Capacity = 4>
+class Register_transaction {
+public:
+
+    static_assert(Capacity > 0UL, "Transaction without capacity.");
+
+    /**
+     *  Constructor.
+     */
+    constexpr Register_transaction();
+
+    /**
+     *  Destructor, commits any pending updates.
+     */
+    ~Register_transaction();
+
+    Register_transaction(const Register_transaction&) = delete;
+    Register_transaction& operator=(const Register_transaction&) = delete;
+
+    /**
+     *  Adds a masked update of a register.
+     *  @tparam     P       Access policy of the register.
+     *  @tparam     S       Storage backend of the register.
+     *  @param[in]  reg     Register to update.
+     *  @param[in]  mask    Bits to overwrite.
+     *  @param[in]  bits    Value of the bits, already shifted in place.
+     *  @return             Reference to this transaction.
+     */
+    template<Access_policy P, class S>
+    Register_transaction& modify(const Memory_register<P, S>& reg, const uint32_t& mask, const uint32_t& bits);
+
+    /**
+     *  Adds an update of the fields of a register.
+     *  @tparam     L       Layout of the register.
+     *  @tparam     P       Access policy of the register.
+     *  @tparam     S       Storage backend of the register.
+     *  @param[in]  reg     Register to update.
+     *  @param[in]  values  Combined fields to write.
+     *  @return             Reference to this transaction.
+     */
+    template<class L, Access_policy P, class S>
+    Register_transaction& modify(const Field_register<L, P, S>& reg, const Field_value<L>& values);
+
+    /**
+     *  Writes all pending updates to their registers.
+     *  @return None.
+     */
+    void commit();
+
+    /**
+     *  Discards all pending updates.
+     *  @return None.
+     */
+    void discard();
+
+    /**
+     *  Number of registers with pending updates.
+     *  @return Number of registers.
+     */
+    constexpr std::size_t size() const;
+
+private:
+
+    /**
+     *  Pending update of a single register.
+     */
+    struct Entry {
+        volatile uint32_t* reg;     /**< Register to update.       */
+        uint32_t           mask;    /**< Bits to overwrite.        */
+        uint32_t           bits;    /**< Value of the bits.        */
+        bool               read;    /**< Register may be read.     */
+    };
+
+    std::array<Entry, Capacity> entries;    /**< Pending updates.           */
+    std::size_t                 count;      /**< Number of pending updates. */
+
+    /**
+     *  Merges an update into the pending entries.
+     *  @param[in]  reg     Register to update.
+     *  @param[in]  mask    Bits to overwrite.
+     *  @param[in]  bits    Value of the bits.
+     *  @param[in]  read    Register may be read.
+     *  @return None.
+     */
+    void add(volatile uint32_t* reg, const uint32_t& mask, const uint32_t& bits, const bool& read);
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+template<std::size_t C>
+constexpr Register_transaction<C>::Register_transaction() :
+    entries {},
+    count   { 0UL } {
+
+}
+
+template<std::size_t C>
+Register_transaction<C>::~Register_transaction() {
+    commit();
+}
+
+template<std::size_t C>
+template<Access_policy P, class S>
+Register_transaction<C>& Register_transaction<C>::modify(const Memory_register<P, S>& reg, const uint32_t& mask, const uint32_t& bits) {
+    static_assert(P != Access_policy::read_only, "Register is read only.");
+    add(&reg, mask, bits, (P == Access_policy::read_write));
+    return *this;
+}
+
+template<std::size_t C>
+template<class L, Access_policy P, class S>
+Register_transaction<C>& Register_transaction<C>::modify(const Field_register<L, P, S>& reg, const Field_value<L>& values) {
+    static_assert(P != Access_policy::read_only, "Register is read only.");
+    add(&reg, values.mask(), values.bits(), (P == Access_policy::read_write));
+    return *this;
+}
+
+template<std::size_t C>
+void Register_transaction<C>::commit() {
+    for(std::size_t i = 0UL; i < count; i++) {
+        const Entry& entry = entries[i];
+        if((entry.mask == 0xFFFF'FFFFUL) || !entry.read) {
+            *entry.reg = entry.bits;
+        } else {
+            *entry.reg = ((*entry.reg & ~entry.mask) | entry.bits);
+        }
+    }
+    count = 0UL;
+}
+
+template<std::size_t C>
+void Register_transaction<C>::discard() {
+    count = 0UL;
+}
+
+template<std::size_t C>
+constexpr std::size_t Register_transaction<C>::size() const {
+    return count;
+}
+
+template<std::size_t C>
+void Register_transaction<C>::add(volatile uint32_t* reg, const uint32_t& mask, const uint32_t& bits, const bool& read) {
+    for(std::size_t i = 0UL; i < count; i++) {
+        Entry& entry = entries[i];
+        if(entry.reg == reg) {
+            entry.mask |= mask;
+            entry.bits  = ((entry.bits & ~mask) | (bits & mask));
+            return;
+        }
+    }
+    if(count == C) {
+        commit();
+    }
+    entries[count] = Entry { reg, mask, (bits & mask), read };
+    count++;
+}
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_REGISTER_TRANSACTION_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
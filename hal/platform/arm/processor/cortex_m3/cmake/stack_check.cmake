@@ -0,0 +1,305 @@
+# -*- mode:CMake -*-
+#==============================================================================#
+# File:     stack_check.cmake
+# Author:   Tom Verloop   <T93.Verloop@gmail.com>
+# Version:  0.1
+# Date:     17-10-2026
+#
+# Worst-case stack depth analysis of an executable.
+#
+# Combines the call graphs emitted by -fcallgraph-info=su with the entries
+# of irq_vector in the linked executable. The main stack must hold the
+# deepest path from the reset handler plus the handlers nesting on top of
+# it. Handlers only preempt handlers of a lower preemption level, so with
+# IRQ_NESTING levels in use at most that many nest, and the deepest
+# IRQ_NESTING handlers, each with its exception frame, bound them.
+# Functions given as process entries run on the process stack.
+#
+# CALLGRAPH_DIR is the object directory of the executable, so call graphs
+# of other executables are not mixed in. Its units must be compiled
+# without LTO, which emits neither stack usage nor call graphs.
+#
+# Usage:
+#   cmake -DELF=<file> -DNM=<nm> -DOBJDUMP=<objdump> -DCALLGRAPH_DIR=<dir>
+#         -DMAIN_STACK_SIZE=<size> -DPROCESS_STACK_SIZE=<size>
+#         [-DIRQ_NESTING=<levels>] [-DPROCESS_ENTRIES=<f,g>]
+#         [-DREPORT=<file>] -P stack_check.cmake
+#
+#==============================================================================#
+
+cmake_minimum_required(VERSION 3.13)
+
+string(REPLACE "," ";" PROCESS_ENTRIES "${PROCESS_ENTRIES}")
+
+# All handlers at one preemption level unless told otherwise.
+if(NOT IRQ_NESTING)
+  set(IRQ_NESTING 1)
+endif()
+if(NOT IRQ_NESTING MATCHES "^[1-9][0-9]*$")
+  message(FATAL_ERROR "Invalid interrupt nesting '${IRQ_NESTING}'.")
+endif()
+
+# Basic exception frame stacked by the Cortex-M3 on entry.
+set(EXCEPTION_FRAME 32)
+
+#------------------------------------------------------------------------------#
+# Converts a linker size (e.g. 1k, 0x400, 2M) to bytes.
+#------------------------------------------------------------------------------#
+
+function(stack_check_size text result)
+  string(STRIP "${text}" text)
+  set(scale 1)
+  if(text MATCHES "^(.+)[kK]$")
+    set(text ${CMAKE_MATCH_1})
+    set(scale 1024)
+  elseif(text MATCHES "^(.+)[mM]$")
+    set(text ${CMAKE_MATCH_1})
+    set(scale 1048576)
+  endif()
+  if(NOT text MATCHES "^(0[xX][0-9a-fA-F]+|[0-9]+)$")
+    message(FATAL_ERROR "Invalid stack size '${text}'.")
+  endif()
+  math(EXPR bytes "${text} * ${scale}")
+  set(${result} ${bytes} PARENT_SCOPE)
+endfunction()
+
+#------------------------------------------------------------------------------#
+# Normalizes an address, optionally clearing the thumb bit.
+#------------------------------------------------------------------------------#
+
+function(stack_check_address text mask result)
+  math(EXPR address "0x${text} & ${mask}" OUTPUT_FORMAT HEXADECIMAL)
+  set(${result} ${address} PARENT_SCOPE)
+endfunction()
+
+#------------------------------------------------------------------------------#
+# Worst-case depth of a function, memoized in global properties.
+# Sets <result> to the depth in bytes and appends to the global property
+# STACK_CHECK_NOTES when the depth is not a true bound.
+#------------------------------------------------------------------------------#
+
+function(stack_check_depth name result)
+  string(MAKE_C_IDENTIFIER "${name}" id)
+  get_property(known GLOBAL PROPERTY STACK_CHECK_DEPTH_${id} SET)
+  if(known)
+    get_property(depth GLOBAL PROPERTY STACK_CHECK_DEPTH_${id})
+    set(${result} ${depth} PARENT_SCOPE)
+    return()
+  endif()
+
+  get_property(visiting GLOBAL PROPERTY STACK_CHECK_VISITING_${id})
+  if(visiting)
+    set_property(GLOBAL APPEND PROPERTY STACK_CHECK_NOTES "recursion through ${name}")
+    set(${result} 0 PARENT_SCOPE)
+    return()
+  endif()
+  set_property(GLOBAL PROPERTY STACK_CHECK_VISITING_${id} ON)
+
+  if(DEFINED frame_${id})
+    set(frame ${frame_${id}})
+    if(qualifier_${id} MATCHES "dynamic" AND NOT qualifier_${id} MATCHES "bounded")
+      set_property(GLOBAL APPEND PROPERTY STACK_CHECK_NOTES "unbounded dynamic stack in ${name}")
+    endif()
+  elseif(name STREQUAL "__indirect_call")
+    set(frame 0)
+  else()
+    set(frame 0)
+    set_property(GLOBAL APPEND PROPERTY STACK_CHECK_NOTES "unknown stack usage of ${name}")
+  endif()
+
+  set(deepest 0)
+  foreach(callee IN LISTS callees_${id})
+    if(callee STREQUAL "__indirect_call")
+      set_property(GLOBAL APPEND PROPERTY STACK_CHECK_NOTES "indirect call in ${name}")
+    endif()
+    stack_check_depth(${callee} depth)
+    if(depth GREATER deepest)
+      set(deepest ${depth})
+    endif()
+  endforeach()
+
+  math(EXPR depth "${frame} + ${deepest}")
+  set_property(GLOBAL PROPERTY STACK_CHECK_VISITING_${id} OFF)
+  set_property(GLOBAL PROPERTY STACK_CHECK_DEPTH_${id} ${depth})
+  set(${result} ${depth} PARENT_SCOPE)
+endfunction()
+
+#==============================================================================#
+# Call graph.
+#==============================================================================#
+
+file(GLOB_RECURSE callgraphs ${CALLGRAPH_DIR}/*.ci)
+if(NOT callgraphs)
+  message(FATAL_ERROR "No call graphs found in ${CALLGRAPH_DIR}, compile with -fcallgraph-info=su and without -flto.")
+endif()
+
+foreach(callgraph IN LISTS callgraphs)
+  file(STRINGS ${callgraph} lines)
+  foreach(line IN LISTS lines)
+    if(line MATCHES "^node: { title: \"([^\"]+)\" label: \".*\\\\n([0-9]+) bytes \\(([a-z,]+)\\)")
+      # Equally named local functions of different units keep the largest frame.
+      string(MAKE_C_IDENTIFIER "${CMAKE_MATCH_1}" id)
+      if(NOT DEFINED frame_${id} OR CMAKE_MATCH_2 GREATER frame_${id})
+        set(frame_${id} ${CMAKE_MATCH_2})
+        set(qualifier_${id} ${CMAKE_MATCH_3})
+      endif()
+    elseif(line MATCHES "^edge: { sourcename: \"([^\"]+)\" targetname: \"([^\"]+)\"")
+      string(MAKE_C_IDENTIFIER "${CMAKE_MATCH_1}" id)
+      list(APPEND callees_${id} ${CMAKE_MATCH_2})
+      list(REMOVE_DUPLICATES callees_${id})
+    endif()
+  endforeach()
+endforeach()
+
+#==============================================================================#
+# Entry points.
+#==============================================================================#
+
+execute_process(
+  COMMAND ${NM} -S ${ELF}
+  OUTPUT_VARIABLE symbols
+  RESULT_VARIABLE status
+)
+if(NOT status EQUAL 0)
+  message(FATAL_ERROR "Failed to read the symbols of ${ELF}.")
+endif()
+string(REPLACE "\n" ";" symbols "${symbols}")
+
+# Function names per address, without thumb bit, and location of the vector table.
+foreach(symbol IN LISTS symbols)
+  if(symbol MATCHES "^([0-9a-fA-F]+) ([0-9a-fA-F]+ )?[TtWw] (.+)$")
+    stack_check_address(${CMAKE_MATCH_1} 0xFFFFFFFE address)
+    list(APPEND functions_${address} ${CMAKE_MATCH_3})
+  elseif(symbol MATCHES "^([0-9a-fA-F]+) ([0-9a-fA-F]+) [RrDd] ([^ ]*irq_vector[^ ]*)$")
+    stack_check_address(${CMAKE_MATCH_1} -1 vector_start)
+    math(EXPR vector_stop "${vector_start} + 0x${CMAKE_MATCH_2}" OUTPUT_FORMAT HEXADECIMAL)
+  endif()
+endforeach()
+if(NOT DEFINED vector_start)
+  message(FATAL_ERROR "No irq_vector in ${ELF}.")
+endif()
+
+execute_process(
+  COMMAND ${OBJDUMP} -s --start-address=${vector_start} --stop-address=${vector_stop} ${ELF}
+  OUTPUT_VARIABLE dump
+  RESULT_VARIABLE status
+)
+if(NOT status EQUAL 0)
+  message(FATAL_ERROR "Failed to read irq_vector of ${ELF}.")
+endif()
+string(REPLACE "\n" ";" dump "${dump}")
+
+# Little endian words, the first holds the initial stack pointer.
+set(vectors)
+foreach(line IN LISTS dump)
+  if(line MATCHES "^ [0-9a-f]+ (([0-9a-f]+ ?)+)")
+    string(REGEX MATCHALL "[0-9a-f]+" words "${CMAKE_MATCH_1}")
+    foreach(word IN LISTS words)
+      string(REGEX REPLACE "^(..)(..)(..)(..)$" "\\4\\3\\2\\1" word ${word})
+      list(APPEND vectors ${word})
+    endforeach()
+  endif()
+endforeach()
+list(LENGTH vectors vector_count)
+if(vector_count LESS 2)
+  message(FATAL_ERROR "Malformed irq_vector in ${ELF}.")
+endif()
+list(REMOVE_AT vectors 0)
+
+set(handlers)
+set(handled)
+foreach(vector IN LISTS vectors)
+  stack_check_address(${vector} 0xFFFFFFFE address)
+  if(address STREQUAL "0x0" OR address IN_LIST handled)
+    continue()
+  endif()
+  list(APPEND handled ${address})
+  # Prefer the name under which the function was compiled over its aliases.
+  set(handler)
+  foreach(name IN LISTS functions_${address})
+    string(MAKE_C_IDENTIFIER "${name}" id)
+    if(DEFINED frame_${id})
+      set(handler ${name})
+      break()
+    endif()
+  endforeach()
+  if(NOT handler)
+    list(GET functions_${address} 0 handler)
+  endif()
+  list(APPEND handlers ${handler})
+endforeach()
+
+# The reset handler is the base of the main stack, not a preempting handler.
+list(GET handlers 0 reset)
+list(REMOVE_AT handlers 0)
+
+#==============================================================================#
+# Analysis.
+#==============================================================================#
+
+set(report "Worst-case stack depth of ${ELF}\n\n")
+
+stack_check_depth(${reset} main_depth)
+string(APPEND report "  ${reset}: ${main_depth} bytes\n")
+set(handler_depths)
+foreach(handler IN LISTS handlers)
+  stack_check_depth(${handler} depth)
+  math(EXPR depth "${depth} + ${EXCEPTION_FRAME}")
+  list(APPEND handler_depths ${depth})
+  string(APPEND report "  ${handler}: ${depth} bytes (with exception frame)\n")
+endforeach()
+
+# The deepest handler of each nesting level, taking the deepest overall.
+list(SORT handler_depths COMPARE NATURAL ORDER DESCENDING)
+list(LENGTH handler_depths nested)
+if(nested GREATER IRQ_NESTING)
+  set(nested ${IRQ_NESTING})
+endif()
+if(nested GREATER 0)
+  list(SUBLIST handler_depths 0 ${nested} handler_depths)
+endif()
+foreach(depth IN LISTS handler_depths)
+  math(EXPR main_depth "${main_depth} + ${depth}")
+endforeach()
+string(APPEND report "  ${nested} nested handler(s) of ${IRQ_NESTING} preemption level(s)\n")
+
+set(process_depth 0)
+foreach(entry IN LISTS PROCESS_ENTRIES)
+  stack_check_depth(${entry} depth)
+  math(EXPR depth "${depth} + ${EXCEPTION_FRAME}")
+  if(depth GREATER process_depth)
+    set(process_depth ${depth})
+  endif()
+  string(APPEND report "  ${entry}: ${depth} bytes (process stack, with exception frame)\n")
+endforeach()
+
+stack_check_size("${MAIN_STACK_SIZE}" main_size)
+stack_check_size("${PROCESS_STACK_SIZE}" process_size)
+
+string(APPEND report "\nMain stack:    ${main_depth} of ${main_size} bytes\n")
+string(APPEND report "Process stack: ${process_depth} of ${process_size} bytes\n")
+
+get_property(notes GLOBAL PROPERTY STACK_CHECK_NOTES)
+if(notes)
+  list(REMOVE_DUPLICATES notes)
+  string(APPEND report "\nNot accounted for:\n")
+  foreach(note IN LISTS notes)
+    string(APPEND report "  ${note}\n")
+  endforeach()
+endif()
+
+if(REPORT)
+  file(WRITE ${REPORT} "${report}")
+endif()
+message("${report}")
+
+if(main_depth GREATER main_size)
+  message(FATAL_ERROR "Main stack needs ${main_depth} bytes, exceeding its size of ${main_size} bytes.")
+endif()
+if(process_depth GREATER process_size)
+  message(FATAL_ERROR "Process stack needs ${process_depth} bytes, exceeding its size of ${process_size} bytes.")
+endif()
+
+#==============================================================================#
+# EOF.
+#==============================================================================#
@@ -0,0 +1,108 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    bit_band.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Bit-band alias access to SRAM and peripheral memory.
+ */
+
+#ifndef BMPP_HAL_CORTEX_M3_BIT_BAND_HPP__
+#define BMPP_HAL_CORTEX_M3_BIT_BAND_HPP__
+
+/* System. */
+#include <cstdint>      /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace cortex_m3 {
+
+/**
+ *  Storage backend mapping registers onto the memory bus, with single bit
+ *  accesses going through the bit-band alias regions where available.
+ *  A store to an alias word is an atomic read-modify-write on the bus.
+ */
+struct Bit_band_storage {
+
+    static const uint32_t sram_base       = 0x2000'0000UL;  /**< SRAM bit-band region.       */
+    static const uint32_t peripheral_base = 0x4000'0000UL;  /**< Peripheral bit-band region. */
+    static const uint32_t region_size     = 0x0010'0000UL;  /**< Size of a bit-band region.  */
+    static const uint32_t alias_offset    = 0x0200'0000UL;  /**< Offset of the alias region. */
+
+    /**
+     *  Maps a register address onto a pointer.
+     *  @param[in] address   Integer representative of the Memory address.
+     *  @return              Pointer to IO Memory.
+     */
+    static inline volatile uint32_t* map(const uint32_t& address) {
+        return reinterpret_cast<volatile uint32_t *>(address);
+    }
+
+    /**
+     *  Checks whether an address lies within a bit-band region.
+     *  @param[in] address   Integer representative of the Memory address.
+     *  @return              True when the address has a bit-band alias.
+     */
+    static constexpr bool is_bit_band(const uint32_t& address) {
+        return (((address - sram_base) < region_size) || ((address - peripheral_base) < region_size));
+    }
+
+    /**
+     *  Computes the alias word of a single bit.
+     *  @param[in] address   Address of the word within a bit-band region.
+     *  @param[in] bit       Bit position within the word.
+     *  @return              Address of the alias word.
+     */
+    static constexpr uint32_t alias(const uint32_t& address, const uint32_t& bit) {
+        return ((address & 0xF000'0000UL) + alias_offset + ((address & 0x000F'FFFCUL) << 5UL) + (bit << 2UL));
+    }
+
+    /**
+     *  Reads a single bit.
+     *  @param[in] address   Address of the word.
+     *  @param[in] bit       Bit position within the word.
+     *  @return              State of the bit.
+     */
+    static inline bool read_bit(const uint32_t& address, const uint32_t& bit) {
+        if(is_bit_band(address)) {
+            return (*map(alias(address, bit)) != 0UL);
+        }
+        return (((*map(address)) >> bit) & 1UL);
+    }
+
+    /**
+     *  Writes a single bit, atomically within the bit-band regions.
+     *  @param[in] address   Address of the word.
+     *  @param[in] bit       Bit position within the word.
+     *  @param[in] value     State to write.
+     *  @return None.
+     */
+    static inline void write_bit(const uint32_t& address, const uint32_t& bit, const bool& value) {
+        if(is_bit_band(address)) {
+            *map(alias(address, bit)) = value ? 1UL : 0UL;
+        } else if(value) {
+            *map(address) |= (1UL << bit);
+        } else {
+            *map(address) &= ~(1UL << bit);
+        }
+    }
+};
+
+} /* namespace cortex_m3 */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_CORTEX_M3_BIT_BAND_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
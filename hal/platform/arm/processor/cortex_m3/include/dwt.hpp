@@ -0,0 +1,204 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    dwt.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Data watchpoint and trace unit.
+ */
+
+#ifndef BMPP_HAL_CORTEX_M3_DWT_HPP__
+#define BMPP_HAL_CORTEX_M3_DWT_HPP__
+
+/* System. */
+#include <cstdint>      /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "mem_access.hpp"       /* Mapped memory access. */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace cortex_m3 {
+
+/**
+ *  Data watchpoint and trace unit, used for its free running processor
+ *  cycle counter and profiling event counters.
+ */
+class Dwt {
+public:
+
+    static const uint32_t base_address = 0xE000'1000UL;  /**< Base address of peripheral. */
+
+    /**
+     *  Snapshot of the cycle and event counters. The event counters are
+     *  8 bits wide, so differences are only exact for short sections.
+     */
+    struct Counters {
+        uint32_t cycles;    /**< Processor cycles.                            */
+        uint8_t  cpi;       /**< Extra cycles of multi-cycle instructions.    */
+        uint8_t  exc;       /**< Cycles of exception entry and exit overhead. */
+        uint8_t  sleep;     /**< Cycles spent sleeping.                       */
+        uint8_t  lsu;       /**< Extra cycles of load and store instructions. */
+        uint8_t  fold;      /**< Folded instructions, taking zero cycles.     */
+
+        /**
+         *  Counter increments between two snapshots.
+         *  @param[in]  rhs     Earlier snapshot.
+         *  @return             Increments.
+         */
+        inline Counters operator-(const Counters& rhs) const;
+    };
+
+    constexpr Dwt();
+
+    /**
+     *  Enables the cycle counter, keeping its current value.
+     *  @return None.
+     */
+    inline void enable() const;
+
+    /**
+     *  Enables the cycle counter from zero, e.g. to count from reset.
+     *  @return None.
+     */
+    inline void restart() const;
+
+    /**
+     *  Checks whether the cycle counter runs.
+     *  @return True when counting.
+     */
+    inline bool is_enabled() const;
+
+    /**
+     *  Processor cycles counted, wrapping at 32 bits.
+     *  @return Cycle count.
+     */
+    inline uint32_t get_cycles() const;
+
+    /**
+     *  Enables the cycle counter and the CPI, exception, sleep, LSU and fold
+     *  event counters, clearing the event counters.
+     *  @return None.
+     */
+    inline void enable_events() const;
+
+    /**
+     *  Reads all counters.
+     *  @return Snapshot of the counters.
+     */
+    inline Counters get_counters() const;
+
+    /**
+     *  Busy waits a number of processor cycles, independent of flash wait
+     *  states. The counter must be enabled.
+     *  @param[in]  cycles  Cycles to wait, below 2^31.
+     *  @return None.
+     */
+    inline void delay(const uint32_t& cycles) const;
+
+private:
+
+    Memory_register<Access_policy::read_write> ctrl;    /**< Control register.                  */
+    Memory_register<Access_policy::read_write> cyccnt;  /**< Cycle count register.              */
+    Memory_register<Access_policy::read_write> cpicnt;  /**< CPI count register.                */
+    Memory_register<Access_policy::read_write> exccnt;  /**< Exception overhead count register. */
+    Memory_register<Access_policy::read_write> sleepcnt;/**< Sleep count register.              */
+    Memory_register<Access_policy::read_write> lsucnt;  /**< LSU count register.                */
+    Memory_register<Access_policy::read_write> foldcnt; /**< Folded instruction count register. */
+    Memory_register<Access_policy::read_write> demcr;   /**< Debug exception and monitor control. */
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+constexpr Dwt::Dwt() :
+    ctrl     (base_address + 0x00),
+    cyccnt   (base_address + 0x04),
+    cpicnt   (base_address + 0x08),
+    exccnt   (base_address + 0x0C),
+    sleepcnt (base_address + 0x10),
+    lsucnt   (base_address + 0x14),
+    foldcnt  (base_address + 0x18),
+    demcr    (0xE000'EDFCUL) {
+
+}
+
+inline void Dwt::enable() const {
+    demcr |= (1UL << 24);   /* Trace enable. */
+    ctrl  |= (1UL << 0);    /* Cycle counter enable. */
+}
+
+inline void Dwt::restart() const {
+    demcr |= (1UL << 24);   /* Trace enable. */
+    cyccnt = 0UL;
+    ctrl  |= (1UL << 0);    /* Cycle counter enable. */
+}
+
+inline bool Dwt::is_enabled() const {
+    return ((ctrl & (1UL << 0)) != 0UL);
+}
+
+inline uint32_t Dwt::get_cycles() const {
+    return cyccnt;
+}
+
+inline void Dwt::enable_events() const {
+    demcr |= (1UL << 24);   /* Trace enable. */
+    cpicnt   = 0UL;
+    exccnt   = 0UL;
+    sleepcnt = 0UL;
+    lsucnt   = 0UL;
+    foldcnt  = 0UL;
+    /* Cycle counter, CPI, exception, sleep, LSU and fold events. */
+    ctrl |= ((1UL << 0) | (1UL << 17) | (1UL << 18) | (1UL << 19) | (1UL << 20) | (1UL << 21));
+}
+
+inline Dwt::Counters Dwt::get_counters() const {
+    return Counters {
+        static_cast<uint32_t>(cyccnt),
+        static_cast<uint8_t>(cpicnt),
+        static_cast<uint8_t>(exccnt),
+        static_cast<uint8_t>(sleepcnt),
+        static_cast<uint8_t>(lsucnt),
+        static_cast<uint8_t>(foldcnt)
+    };
+}
+
+inline Dwt::Counters Dwt::Counters::operator-(const Counters& rhs) const {
+    return Counters {
+        static_cast<uint32_t>(cycles - rhs.cycles),
+        static_cast<uint8_t>(cpi - rhs.cpi),
+        static_cast<uint8_t>(exc - rhs.exc),
+        static_cast<uint8_t>(sleep - rhs.sleep),
+        static_cast<uint8_t>(lsu - rhs.lsu),
+        static_cast<uint8_t>(fold - rhs.fold)
+    };
+}
+
+inline void Dwt::delay(const uint32_t& cycles) const {
+    const uint32_t start = cyccnt;
+    while((cyccnt - start) < cycles) {
+        /* Wait. */
+    }
+}
+
+} /* namespace cortex_m3 */
+
+constexpr cortex_m3::Dwt dwt;
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_CORTEX_M3_DWT_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
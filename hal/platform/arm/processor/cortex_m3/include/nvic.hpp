@@ -1,8 +1,23 @@
 /* -*- mode: c++ -*- */
+/**
+ * @file    nvic.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Nested vectored interrupt controller.
+ */
 
 #ifndef BMPP_HAL_CORTEX_M3_NVIC_HPP__
 #define BMPP_HAL_CORTEX_M3_NVIC_HPP__
 
+/* System. */
+#include <cstdint>      /* Fixed size integers. */
+#include <type_traits>  /* Interrupt number types. */
+
+/* Third-party. */
+
+
+/* Local. */
 #include "mem_access.hpp"
 
 namespace bmpp {
@@ -11,6 +26,411 @@ namespace hal {
 
 namespace cortex_m3 {
 
+/**
+ *  Enables interrupts, clearing PRIMASK.
+ *  @return None.
+ */
+inline void enable_interrupts() {
+    asm volatile ("cpsie i" : : : "memory");
+}
+
+/**
+ *  Disables interrupts, setting PRIMASK.
+ *  @return None.
+ */
+inline void disable_interrupts() {
+    asm volatile ("cpsid i" : : : "memory");
+}
+
+/**
+ *  Disables interrupts, keeping the previous state of PRIMASK.
+ *  @return PRIMASK before disabling, for restore_interrupts().
+ */
+inline uint32_t save_and_disable_interrupts() {
+    uint32_t primask;
+    asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory");
+    return primask;
+}
+
+/**
+ *  Restores PRIMASK, enabling interrupts only when they were enabled before
+ *  save_and_disable_interrupts().
+ *  @param[in]  primask Saved PRIMASK.
+ *  @return None.
+ */
+inline void restore_interrupts(const uint32_t& primask) {
+    asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+}
+
+/**
+ *  Masks all interrupts with a priority value of at least the given value,
+ *  leaving more urgent interrupts running. Zero unmasks all.
+ *  @param[in]  basepri Priority byte, as stored in the priority registers.
+ *  @return None.
+ */
+inline void set_basepri(const uint8_t& basepri) {
+    asm volatile ("msr basepri, %0" : : "r" (static_cast<uint32_t>(basepri)) : "memory");
+}
+
+/**
+ *  Points the processor at a vector table, through the vector table offset
+ *  register. The table must be aligned to its size rounded up to a power
+ *  of two, and at least to 128 bytes.
+ *  @param[in]  table   Address of the vector table.
+ *  @return None.
+ */
+inline void set_vector_table(const uint32_t& table) {
+    *Default_storage::map(0xE000'ED08UL) = table;
+    asm volatile ("dsb\n\tisb" : : : "memory");
+}
+
+/**
+ *  Address of the active vector table.
+ *  @return Address of the vector table.
+ */
+inline uint32_t get_vector_table() {
+    return *Default_storage::map(0xE000'ED08UL);
+}
+
+/**
+ *  System exceptions with a configurable priority, numbered like device
+ *  interrupts relative to IRQ0.
+ */
+enum class Exception : int8_t {
+    memmanage     = -12,    /**< Memory management fault.      */
+    busfault      = -11,    /**< Bus fault.                    */
+    usagefault    = -10,    /**< Usage fault.                  */
+    svcall        =  -5,    /**< Supervisor call.              */
+    debug_monitor =  -4,    /**< Debug monitor.                */
+    pendsv        =  -2,    /**< Pendable service request.     */
+    systick       =  -1     /**< System tick timer.            */
+};
+
+/**
+ *  Nested vectored interrupt controller.
+ *  Interrupts are numbered from IRQ0, every operation is a single store
+ *  or load of the register holding the interrupt. Enable, disable, pend
+ *  and unpend use the set/clear register pairs and never read-modify-write.
+ *  Only the priority functions take system exceptions, the others reject
+ *  signed interrupt numbers at compile time.
+ *  @tparam Priority_bits   Implemented priority bits of the device.
+ */
+template<uint8_t Priority_bits>
+class Nvic {
+public:
+
+    static_assert((Priority_bits >= 3U) && (Priority_bits <= 8U), "Invalid number of priority bits.");
+
+    static const uint32_t iser_address    = 0xE000'E100UL;  /**< Interrupt set-enable.        */
+    static const uint32_t icer_address    = 0xE000'E180UL;  /**< Interrupt clear-enable.      */
+    static const uint32_t ispr_address    = 0xE000'E200UL;  /**< Interrupt set-pending.       */
+    static const uint32_t icpr_address    = 0xE000'E280UL;  /**< Interrupt clear-pending.     */
+    static const uint32_t iabr_address    = 0xE000'E300UL;  /**< Interrupt active bit.        */
+    static const uint32_t ipr_address     = 0xE000'E400UL;  /**< Interrupt priority.          */
+    static const uint32_t shpr_address    = 0xE000'ED18UL;  /**< System handler priority.     */
+    static const uint32_t aircr_key       = 0x05FA'0000UL;  /**< AIRCR write key.             */
+    static const uint8_t  priority_levels = (1U << Priority_bits);  /**< Number of priorities. */
+
+    constexpr Nvic();
+
+    /**
+     *  Enables an interrupt.
+     *  @tparam     Irq     Type of the interrupt number.
+     *  @param[in]  irq     Interrupt number.
+     *  @return None.
+     */
+    template<typename Irq>
+    inline void enable(const Irq& irq) const;
+
+    /**
+     *  Disables an interrupt.
+     *  @tparam     Irq     Type of the interrupt number.
+     *  @param[in]  irq     Interrupt number.
+     *  @return None.
+     */
+    template<typename Irq>
+    inline void disable(const Irq& irq) const;
+
+    /**
+     *  Checks whether an interrupt is enabled.
+     *  @tparam     Irq     Type of the interrupt number.
+     *  @param[in]  irq     Interrupt number.
+     *  @return             True when enabled.
+     */
+    template<typename Irq>
+    inline bool is_enabled(const Irq& irq) const;
+
+    /**
+     *  Sets an interrupt pending.
+     *  @tparam     Irq     Type of the interrupt number.
+     *  @param[in]  irq     Interrupt number.
+     *  @return None.
+     */
+    template<typename Irq>
+    inline void set_pending(const Irq& irq) const;
+
+    /**
+     *  Clears a pending interrupt.
+     *  @tparam     Irq     Type of the interrupt number.
+     *  @param[in]  irq     Interrupt number.
+     *  @return None.
+     */
+    template<typename Irq>
+    inline void clear_pending(const Irq& irq) const;
+
+    /**
+     *  Checks whether an interrupt is pending.
+     *  @tparam     Irq     Type of the interrupt number.
+     *  @param[in]  irq     Interrupt number.
+     *  @return             True when pending.
+     */
+    template<typename Irq>
+    inline bool is_pending(const Irq& irq) const;
+
+    /**
+     *  Checks whether an interrupt is being serviced.
+     *  @tparam     Irq     Type of the interrupt number.
+     *  @param[in]  irq     Interrupt number.
+     *  @return             True when active.
+     */
+    template<typename Irq>
+    inline bool is_active(const Irq& irq) const;
+
+    /**
+     *  Triggers an interrupt from software, through the software trigger
+     *  interrupt register.
+     *  @tparam     Irq     Type of the interrupt number.
+     *  @param[in]  irq     Interrupt number.
+     *  @return None.
+     */
+    template<typename Irq>
+    inline void trigger(const Irq& irq) const;
+
+    /**
+     *  Sets the priority of an interrupt or system exception, 0 being the
+     *  highest. The priority register is written with a single byte store.
+     *  @tparam     Irq         Type of the interrupt number.
+     *  @param[in]  irq         Interrupt number or Exception.
+     *  @param[in]  priority    Priority, below priority_levels.
+     *  @return None.
+     */
+    template<typename Irq>
+    inline void set_priority(const Irq& irq, const uint8_t& priority) const;
+
+    /**
+     *  Gets the priority of an interrupt or system exception.
+     *  @tparam     Irq     Type of the interrupt number.
+     *  @param[in]  irq     Interrupt number or Exception.
+     *  @return             Priority.
+     */
+    template<typename Irq>
+    inline uint8_t get_priority(const Irq& irq) const;
+
+    /**
+     *  Sets the number of priority bits used for preemption, the remaining
+     *  bits select the sub-priority within a preemption level.
+     *  @param[in]  preempt_bits    Preemption bits, at most Priority_bits.
+     *  @return None.
+     */
+    void set_priority_grouping(const uint8_t& preempt_bits) const;
+
+    /**
+     *  Gets the number of priority bits used for preemption.
+     *  @return Preemption bits.
+     */
+    uint8_t get_priority_grouping() const;
+
+    /**
+     *  Combines a preemption priority and sub-priority into a priority.
+     *  @param[in]  preempt_bits    Preemption bits of the grouping.
+     *  @param[in]  preempt         Preemption priority.
+     *  @param[in]  sub             Sub-priority.
+     *  @return                     Priority.
+     */
+    static constexpr uint8_t encode_priority(const uint8_t& preempt_bits, const uint8_t& preempt, const uint8_t& sub);
+
+    /**
+     *  Masks all interrupts with a priority of at least the given one
+     *  through BASEPRI, leaving more urgent interrupts running.
+     *  @param[in]  priority    Lowest masked priority, 0 unmasks all.
+     *  @return None.
+     */
+    static inline void mask(const uint8_t& priority);
+
+private:
+
+    Memory_register<Access_policy::read_write> aircr;   /**< Application interrupt and reset.    */
+    Memory_register<Access_policy::write_only> stir;    /**< Software trigger interrupt.         */
+
+    /**
+     *  Register of a bank holding the bit of an interrupt.
+     *  @param[in]  bank    Address of the first register of the bank.
+     *  @param[in]  irq     Interrupt number.
+     *  @return             Pointer to the register.
+     */
+    static inline volatile uint32_t* word(const uint32_t& bank, const int32_t& irq);
+
+    /**
+     *  Bit of an interrupt within its word.
+     *  @param[in]  irq     Interrupt number.
+     *  @return             Bitmask.
+     */
+    static constexpr uint32_t bit(const int32_t& irq);
+
+    /**
+     *  Priority byte of an interrupt or system exception.
+     *  @param[in]  irq     Interrupt number.
+     *  @return             Pointer to the priority byte.
+     */
+    static inline volatile uint8_t* priority_byte(const int32_t& irq);
+
+    /**
+     *  Checks whether a type numbers device interrupts only. System
+     *  exceptions have negative numbers, without enable, pending or active
+     *  bits in the banks.
+     *  @tparam Irq Type of the interrupt number.
+     *  @return     True for unsigned integers and enums of them.
+     */
+    template<typename Irq>
+    static constexpr bool is_device_irq();
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+/* Register addresses are passed by reference. */
+template<uint8_t B> const uint32_t Nvic<B>::iser_address;
+template<uint8_t B> const uint32_t Nvic<B>::icer_address;
+template<uint8_t B> const uint32_t Nvic<B>::ispr_address;
+template<uint8_t B> const uint32_t Nvic<B>::icpr_address;
+template<uint8_t B> const uint32_t Nvic<B>::iabr_address;
+
+template<uint8_t B>
+constexpr Nvic<B>::Nvic() :
+    aircr (0xE000'ED0CUL),
+    stir  (0xE000'EF00UL) {
+
+}
+
+template<uint8_t B>
+template<typename Irq>
+inline void Nvic<B>::enable(const Irq& irq) const {
+    static_assert(is_device_irq<Irq>(), "System exceptions have no enable, pending or active bits.");
+    *word(iser_address, static_cast<int32_t>(irq)) = bit(static_cast<int32_t>(irq));
+}
+
+template<uint8_t B>
+template<typename Irq>
+inline void Nvic<B>::disable(const Irq& irq) const {
+    static_assert(is_device_irq<Irq>(), "System exceptions have no enable, pending or active bits.");
+    *word(icer_address, static_cast<int32_t>(irq)) = bit(static_cast<int32_t>(irq));
+}
+
+template<uint8_t B>
+template<typename Irq>
+inline bool Nvic<B>::is_enabled(const Irq& irq) const {
+    static_assert(is_device_irq<Irq>(), "System exceptions have no enable, pending or active bits.");
+    return ((*word(iser_address, static_cast<int32_t>(irq)) & bit(static_cast<int32_t>(irq))) != 0UL);
+}
+
+template<uint8_t B>
+template<typename Irq>
+inline void Nvic<B>::set_pending(const Irq& irq) const {
+    static_assert(is_device_irq<Irq>(), "System exceptions have no enable, pending or active bits.");
+    *word(ispr_address, static_cast<int32_t>(irq)) = bit(static_cast<int32_t>(irq));
+}
+
+template<uint8_t B>
+template<typename Irq>
+inline void Nvic<B>::clear_pending(const Irq& irq) const {
+    static_assert(is_device_irq<Irq>(), "System exceptions have no enable, pending or active bits.");
+    *word(icpr_address, static_cast<int32_t>(irq)) = bit(static_cast<int32_t>(irq));
+}
+
+template<uint8_t B>
+template<typename Irq>
+inline bool Nvic<B>::is_pending(const Irq& irq) const {
+    static_assert(is_device_irq<Irq>(), "System exceptions have no enable, pending or active bits.");
+    return ((*word(ispr_address, static_cast<int32_t>(irq)) & bit(static_cast<int32_t>(irq))) != 0UL);
+}
+
+template<uint8_t B>
+template<typename Irq>
+inline bool Nvic<B>::is_active(const Irq& irq) const {
+    static_assert(is_device_irq<Irq>(), "System exceptions have no enable, pending or active bits.");
+    return ((*word(iabr_address, static_cast<int32_t>(irq)) & bit(static_cast<int32_t>(irq))) != 0UL);
+}
+
+template<uint8_t B>
+template<typename Irq>
+inline void Nvic<B>::trigger(const Irq& irq) const {
+    static_assert(is_device_irq<Irq>(), "System exceptions have no enable, pending or active bits.");
+    stir = static_cast<uint32_t>(irq);
+}
+
+template<uint8_t B>
+template<typename Irq>
+inline void Nvic<B>::set_priority(const Irq& irq, const uint8_t& priority) const {
+    *priority_byte(static_cast<int32_t>(irq)) = static_cast<uint8_t>(priority << (8U - B));
+}
+
+template<uint8_t B>
+template<typename Irq>
+inline uint8_t Nvic<B>::get_priority(const Irq& irq) const {
+    return static_cast<uint8_t>(*priority_byte(static_cast<int32_t>(irq)) >> (8U - B));
+}
+
+template<uint8_t B>
+void Nvic<B>::set_priority_grouping(const uint8_t& preempt_bits) const {
+    /* PRIGROUP is the bit position of the binary point within the byte. */
+    const uint32_t prigroup = (7UL - ((preempt_bits < B) ? preempt_bits : B)) & 0x7UL;
+    aircr = (aircr_key | (prigroup << 8));
+}
+
+template<uint8_t B>
+uint8_t Nvic<B>::get_priority_grouping() const {
+    const uint8_t preempt_bits = static_cast<uint8_t>(7U - ((aircr >> 8) & 0x7UL));
+    return (preempt_bits < B) ? preempt_bits : B;
+}
+
+template<uint8_t B>
+constexpr uint8_t Nvic<B>::encode_priority(const uint8_t& preempt_bits, const uint8_t& preempt, const uint8_t& sub) {
+    return static_cast<uint8_t>(((preempt & ((1U << preempt_bits) - 1U)) << (B - preempt_bits))
+                              | (sub & ((1U << (B - preempt_bits)) - 1U)));
+}
+
+template<uint8_t B>
+inline void Nvic<B>::mask(const uint8_t& priority) {
+    set_basepri(static_cast<uint8_t>(priority << (8U - B)));
+}
+
+template<uint8_t B>
+inline volatile uint32_t* Nvic<B>::word(const uint32_t& bank, const int32_t& irq) {
+    return Default_storage::map(bank + ((static_cast<uint32_t>(irq) >> 5) * 4UL));
+}
+
+template<uint8_t B>
+constexpr uint32_t Nvic<B>::bit(const int32_t& irq) {
+    return (1UL << (static_cast<uint32_t>(irq) & 0x1FUL));
+}
+
+template<uint8_t B>
+inline volatile uint8_t* Nvic<B>::priority_byte(const int32_t& irq) {
+    /* System exceptions 4 to 15 live in SHPR1-3, IRQs in IPR0-59. */
+    const uint32_t address = (irq < 0) ? (shpr_address + static_cast<uint32_t>(irq + 16 - 4))
+                                       : (ipr_address + static_cast<uint32_t>(irq));
+    return reinterpret_cast<volatile uint8_t*>(Default_storage::map(address & ~0x3UL)) + (address & 0x3UL);
+}
+
+template<uint8_t B>
+template<typename Irq>
+constexpr bool Nvic<B>::is_device_irq() {
+    return std::is_unsigned<typename std::conditional<std::is_enum<Irq>::value, std::underlying_type<Irq>,
+                                                      std::common_type<Irq>>::type::type>::value;
+}
+
 } /* namespace cortex_m3 */
 
 } /* namespace hal */
@@ -18,3 +438,7 @@ namespace cortex_m3 {
 } /* namespace bmpp */
 
 #endif /* BMPP_HAL_CORTEX_M3_NVIC_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
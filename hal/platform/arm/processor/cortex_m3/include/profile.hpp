@@ -0,0 +1,295 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    profile.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Cycle and event counter profiling probes.
+ */
+
+#ifndef BMPP_HAL_CORTEX_M3_PROFILE_HPP__
+#define BMPP_HAL_CORTEX_M3_PROFILE_HPP__
+
+/* System. */
+#include <cstdint>      /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "dwt.hpp"      /* Cycle counter. */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace cortex_m3 {
+
+/**
+ *  Named measurement point aggregating the cycles and DWT event counts of
+ *  every sample. Probes register themselves on their first sample, so only
+ *  probes which were hit are exported. A probe must only be sampled from
+ *  one context, e.g. one ISR or the main loop.
+ */
+class Probe {
+public:
+
+    /**
+     *  Event counts summed over all samples. The DWT event counters are 8
+     *  bits wide, so a sample counting more than 255 events of a kind loses
+     *  multiples of 256 of them; keep profiled sections short to compare
+     *  them.
+     */
+    struct Events {
+        uint64_t cpi;       /**< Extra cycles of multi-cycle instructions.    */
+        uint64_t exc;       /**< Cycles of exception entry and exit overhead. */
+        uint64_t sleep;     /**< Cycles spent sleeping.                       */
+        uint64_t lsu;       /**< Extra cycles of load and store instructions. */
+        uint64_t fold;      /**< Folded instructions, taking zero cycles.     */
+    };
+
+    /**
+     *  Constructor.
+     *  @param[in]  name    Name of the probe, with static storage.
+     */
+    constexpr explicit Probe(const char* name);
+
+    Probe(const Probe&) = delete;
+    Probe& operator=(const Probe&) = delete;
+
+    /**
+     *  Adds a sample. The measurement overhead is subtracted when reading.
+     *  @param[in]  cycles  Cycles of the sample.
+     *  @return None.
+     */
+    inline void record(const uint32_t& cycles);
+
+    /**
+     *  Adds a sample of cycles and events, e.g. the difference of two
+     *  counter snapshots.
+     *  @param[in]  sample  Counter increments of the sample.
+     *  @return None.
+     */
+    inline void record(const Dwt::Counters& sample);
+
+    /**
+     *  Clears all samples.
+     *  @return None.
+     */
+    void reset();
+
+    const char* get_name() const;       /**< @return Name of the probe.        */
+    uint32_t get_count() const;         /**< @return Number of samples.        */
+    uint32_t get_min() const;           /**< @return Fewest cycles of samples. */
+    uint32_t get_max() const;           /**< @return Most cycles of samples.   */
+    uint64_t get_total() const;         /**< @return Cycles of all samples.    */
+    uint32_t get_mean() const;          /**< @return Mean cycles of samples.   */
+    Events get_events() const;          /**< @return Events of all samples.    */
+
+    /**
+     *  First registered probe, for iterating over all probes.
+     *  @return Pointer to the probe, or nullptr.
+     */
+    static const Probe* first();
+
+    /**
+     *  Next registered probe.
+     *  @return Pointer to the probe, or nullptr.
+     */
+    const Probe* next() const;
+
+private:
+
+    const char* name;       /**< Name of the probe.             */
+    Probe*      link;       /**< Next registered probe.         */
+    bool        linked;     /**< Registered in the probe list.  */
+    uint32_t    count;      /**< Number of samples.             */
+    uint32_t    min;        /**< Fewest cycles.                 */
+    uint32_t    max;        /**< Most cycles.                   */
+    uint64_t    total;      /**< Sum of cycles.                 */
+    Events      events;     /**< Sums of events.                */
+
+    /**
+     *  Adds the probe to the probe list once, with interrupts disabled, as
+     *  the first samples of two probes may come from different contexts.
+     *  @return None.
+     */
+    void enlist();
+
+    friend void reset_probes();
+
+};
+
+/**
+ *  Samples the cycles and events of its lifetime into a probe.
+ *  Compiles to nothing without PROFILE.
+ */
+class Scoped_timer {
+public:
+
+    /**
+     *  Constructor, starts the measurement.
+     *  @param[in]  probe   Probe receiving the sample.
+     */
+    inline explicit Scoped_timer(Probe& probe);
+
+    /**
+     *  Destructor, records the measurement.
+     */
+    inline ~Scoped_timer();
+
+    Scoped_timer(const Scoped_timer&) = delete;
+    Scoped_timer& operator=(const Scoped_timer&) = delete;
+
+private:
+
+#if defined(PROFILE) && (PROFILE != 0)
+    Probe&        probe;    /**< Probe receiving the sample.    */
+    Dwt::Counters start;    /**< Counters at construction.      */
+#endif
+
+};
+
+/**
+ *  Enables the DWT counters and measures the overhead of a measurement,
+ *  in cycles and events, which is subtracted from every sample.
+ *  @return Overhead in cycles.
+ */
+uint32_t start_profiling();
+
+/**
+ *  Overhead of a measurement subtracted from every sample.
+ *  @return Overhead in cycles.
+ */
+uint32_t get_profiling_overhead();
+
+/**
+ *  Clears the samples of all registered probes.
+ *  @return None.
+ */
+void reset_probes();
+
+/**
+ *  Passes every registered probe to a function, e.g. to print them over a
+ *  serial port or to copy them to a buffer read by the debugger.
+ *  @tparam     F       Callable taking a const Probe&.
+ *  @param[in]  export_probe    Function receiving the probes.
+ *  @return None.
+ */
+template<typename F>
+void export_probes(F&& export_probe);
+
+} /* namespace cortex_m3 */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+/**
+ *  Profiles the rest of the enclosing scope into a probe of the given name.
+ *  The probe is constant initialized, so it costs no startup code, and the
+ *  macro expands to nothing without PROFILE.
+ *
+ *  Usage:
+ *      void usart1_handler() {
+ *          BMPP_PROFILE_SCOPE("usart1_handler");
+ *          ...
+ *      }
+ */
+#if defined(PROFILE) && (PROFILE != 0)
+#define BMPP_PROFILE_SCOPE(name) BMPP_PROFILE_SCOPE_AT(name, __LINE__)
+#define BMPP_PROFILE_SCOPE_AT(name, line) BMPP_PROFILE_SCOPE_IMPL(name, line)
+#define BMPP_PROFILE_SCOPE_IMPL(name, line)                                        \
+    static ::bmpp::hal::cortex_m3::Probe bmpp_probe_##line { name };               \
+    const ::bmpp::hal::cortex_m3::Scoped_timer bmpp_timer_##line { bmpp_probe_##line }
+#else
+#define BMPP_PROFILE_SCOPE(name)
+#endif
+
+namespace bmpp {
+
+namespace hal {
+
+namespace cortex_m3 {
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+constexpr Probe::Probe(const char* name) :
+    name   { name },
+    link   { nullptr },
+    linked { false },
+    count  { 0UL },
+    min    { UINT32_MAX },
+    max    { 0UL },
+    total  { 0ULL },
+    events { 0ULL, 0ULL, 0ULL, 0ULL, 0ULL } {
+
+}
+
+inline void Probe::record(const uint32_t& cycles) {
+    if(!linked) {
+        enlist();
+    }
+    count++;
+    total += cycles;
+    if(cycles < min) {
+        min = cycles;
+    }
+    if(cycles > max) {
+        max = cycles;
+    }
+}
+
+inline void Probe::record(const Dwt::Counters& sample) {
+    record(sample.cycles);
+    events.cpi   += sample.cpi;
+    events.exc   += sample.exc;
+    events.sleep += sample.sleep;
+    events.lsu   += sample.lsu;
+    events.fold  += sample.fold;
+}
+
+#if defined(PROFILE) && (PROFILE != 0)
+
+inline Scoped_timer::Scoped_timer(Probe& probe) :
+    probe { probe },
+    start { dwt.get_counters() } {
+
+}
+
+inline Scoped_timer::~Scoped_timer() {
+    probe.record(dwt.get_counters() - start);
+}
+
+#else
+
+inline Scoped_timer::Scoped_timer(Probe&) {
+
+}
+
+inline Scoped_timer::~Scoped_timer() {
+
+}
+
+#endif
+
+template<typename F>
+void export_probes(F&& export_probe) {
+    for(const Probe* probe = Probe::first(); probe != nullptr; probe = probe->next()) {
+        export_probe(*probe);
+    }
+}
+
+} /* namespace cortex_m3 */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_CORTEX_M3_PROFILE_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
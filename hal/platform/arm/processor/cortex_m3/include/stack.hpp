@@ -48,7 +48,38 @@ volatile uint32_t* get_msp();
 volatile uint32_t* get_psp();
 
 constexpr Array_wrapper<const volatile uint32_t> main_stack(&__main_stack_start, &__main_stack_end);
-constexpr Array_wrapper<const volatile uint32_t> process_stack(&__main_stack_start, &__main_stack_end);
+constexpr Array_wrapper<const volatile uint32_t> process_stack(&__process_stack_start, &__process_stack_end);
+
+const uint32_t stack_pattern = 0xA5A5'A5A5UL;  /**< Pattern of unused stack words. */
+
+/**
+ *  Fills the unused part of the main stack, below the current stack
+ *  pointer, with the stack pattern. Called by reset_handler.
+ *  @return None.
+ */
+void paint_main_stack();
+
+/**
+ *  Fills the entire process stack with the stack pattern. Must be called
+ *  before the process stack is used.
+ *  @return None.
+ */
+void paint_process_stack();
+
+/**
+ *  Deepest use of a painted stack, found as the lowest word no longer
+ *  holding the stack pattern.
+ *  @param[in]  stack   Stack region.
+ *  @return             High-water mark in bytes.
+ */
+std::size_t get_stack_usage(const Array_wrapper<const volatile uint32_t>& stack);
+
+/**
+ *  Bytes of a painted stack which were never used.
+ *  @param[in]  stack   Stack region.
+ *  @return             Unused bytes.
+ */
+std::size_t get_stack_free(const Array_wrapper<const volatile uint32_t>& stack);
 
 } /* cortex_m3 */
 
@@ -0,0 +1,145 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    systick.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   System tick timer.
+ */
+
+#ifndef BMPP_HAL_CORTEX_M3_SYSTICK_HPP__
+#define BMPP_HAL_CORTEX_M3_SYSTICK_HPP__
+
+/* System. */
+#include <cstdint>      /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "mem_access.hpp"       /* Mapped memory access. */
+#include "register_field.hpp"   /* Register bitfields.   */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace cortex_m3 {
+
+/**
+ *  24-bit down counting system tick timer.
+ */
+class Systick {
+public:
+
+    static const uint32_t base_address = 0xE000'E010UL;  /**< Base address of peripheral. */
+    static const uint32_t max_reload   = 0x00FF'FFFFUL;  /**< Largest reload value.       */
+
+    /**
+     *  Control and status register layout.
+     */
+    struct Csr {
+        using enable    = Field<Csr,  0, 1, Access_policy::read_write, bool>;  /**< Counter enable.        */
+        using tickint   = Field<Csr,  1, 1, Access_policy::read_write, bool>;  /**< Interrupt enable.      */
+        using clksource = Field<Csr,  2, 1, Access_policy::read_write, bool>;  /**< Processor clock.       */
+        using countflag = Field<Csr, 16, 1, Access_policy::read_only,  bool>;  /**< Reached zero.          */
+    };
+
+    constexpr Systick();
+
+    /**
+     *  Starts the timer from the processor clock, raising the SysTick
+     *  exception every period.
+     *  @param[in]  period  Cycles per period, 2 to max_reload + 1.
+     *  @return             False, leaving the timer alone, when out of range.
+     */
+    inline bool start(const uint32_t& period) const;
+
+    /**
+     *  Stops the timer.
+     *  @return None.
+     */
+    inline void stop() const;
+
+    /**
+     *  Current counter value, counting down from period - 1 to zero.
+     *  @return Counter value.
+     */
+    inline uint32_t get_value() const;
+
+    /**
+     *  Cycles per period.
+     *  @return Period in cycles.
+     */
+    inline uint32_t get_period() const;
+
+    /**
+     *  Checks whether the SysTick exception is pending, i.e. the counter
+     *  wrapped but the handler did not run yet, e.g. while masked.
+     *  @return True when pending.
+     */
+    inline bool is_pending() const;
+
+private:
+
+    Field_register<Csr>                        csr;     /**< Control and status register.  */
+    Memory_register<Access_policy::read_write> rvr;     /**< Reload value register.        */
+    Memory_register<Access_policy::read_write> cvr;     /**< Current value register.       */
+    Memory_register<Access_policy::read_only>  calib;   /**< Calibration value register.   */
+    Memory_register<Access_policy::read_write> icsr;    /**< Interrupt control and state.  */
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+constexpr Systick::Systick() :
+    csr   (base_address + 0x00),
+    rvr   (base_address + 0x04),
+    cvr   (base_address + 0x08),
+    calib (base_address + 0x0C),
+    icsr  (0xE000'ED04UL) {
+
+}
+
+inline bool Systick::start(const uint32_t& period) const {
+    if((period < 2UL) || (period > (max_reload + 1UL))) {
+        return false;
+    }
+    csr.write(Csr::enable::clear());
+    rvr = (period - 1UL);
+    cvr = 0UL;
+    csr.write(Csr::clksource::set() | Csr::tickint::set() | Csr::enable::set());
+    return true;
+}
+
+inline void Systick::stop() const {
+    csr.write(Csr::enable::clear());
+}
+
+inline uint32_t Systick::get_value() const {
+    return cvr;
+}
+
+inline uint32_t Systick::get_period() const {
+    return (rvr + 1UL);
+}
+
+inline bool Systick::is_pending() const {
+    return ((icsr & (1UL << 26)) != 0UL);    /* PENDSTSET. */
+}
+
+} /* namespace cortex_m3 */
+
+constexpr cortex_m3::Systick systick;
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_CORTEX_M3_SYSTICK_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
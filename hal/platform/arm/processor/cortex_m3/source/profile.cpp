@@ -0,0 +1,127 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    profile.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Cycle counter profiling probes.
+ */
+
+/* System. */
+
+/* Third-party. */
+
+/* Local. */
+#include "profile.hpp"
+#include "nvic.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace cortex_m3 {
+
+namespace {
+
+Probe*        probes;       /**< Most recently registered probe.  */
+Dwt::Counters overhead;     /**< Counts of an empty measurement.  */
+
+/**
+ *  Sum of events less the overhead of each sample.
+ *  @param[in]  total       Sum of events.
+ *  @param[in]  per_sample  Overhead of one sample.
+ *  @param[in]  count       Number of samples.
+ *  @return                 Events.
+ */
+uint64_t net(const uint64_t& total, const uint8_t& per_sample, const uint32_t& count) {
+    const uint64_t total_overhead = static_cast<uint64_t>(per_sample) * count;
+    return (total > total_overhead) ? (total - total_overhead) : 0ULL;
+}
+
+} /* namespace */
+
+void Probe::reset() {
+    count = 0UL;
+    min   = UINT32_MAX;
+    max   = 0UL;
+    total = 0ULL;
+    events = Events { 0ULL, 0ULL, 0ULL, 0ULL, 0ULL };
+}
+
+const char* Probe::get_name() const {
+    return name;
+}
+
+uint32_t Probe::get_count() const {
+    return count;
+}
+
+uint32_t Probe::get_min() const {
+    return ((count != 0UL) && (min > overhead.cycles)) ? (min - overhead.cycles) : 0UL;
+}
+
+uint32_t Probe::get_max() const {
+    return (max > overhead.cycles) ? (max - overhead.cycles) : 0UL;
+}
+
+uint64_t Probe::get_total() const {
+    const uint64_t total_overhead = static_cast<uint64_t>(overhead.cycles) * count;
+    return (total > total_overhead) ? (total - total_overhead) : 0ULL;
+}
+
+uint32_t Probe::get_mean() const {
+    return (count != 0UL) ? static_cast<uint32_t>(get_total() / count) : 0UL;
+}
+
+Probe::Events Probe::get_events() const {
+    return Events {
+        net(events.cpi,   overhead.cpi,   count),
+        net(events.exc,   overhead.exc,   count),
+        net(events.sleep, overhead.sleep, count),
+        net(events.lsu,   overhead.lsu,   count),
+        net(events.fold,  overhead.fold,  count)
+    };
+}
+
+const Probe* Probe::first() {
+    return probes;
+}
+
+const Probe* Probe::next() const {
+    return link;
+}
+
+void Probe::enlist() {
+    /* A probe first sampled by an interrupt in between would be lost. */
+    const uint32_t primask = save_and_disable_interrupts();
+    if(!linked) {
+        link   = probes;
+        probes = this;
+        linked = true;
+    }
+    restore_interrupts(primask);
+}
+
+uint32_t start_profiling() {
+    dwt.enable_events();
+    /* Back to back snapshots, as a Scoped_timer takes. */
+    const Dwt::Counters start = dwt.get_counters();
+    overhead = dwt.get_counters() - start;
+    return overhead.cycles;
+}
+
+uint32_t get_profiling_overhead() {
+    return overhead.cycles;
+}
+
+void reset_probes() {
+    for(Probe* probe = probes; probe != nullptr; probe = probe->link) {
+        probe->reset();
+    }
+}
+
+} /* namespace cortex_m3 */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
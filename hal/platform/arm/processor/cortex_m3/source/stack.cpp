@@ -20,6 +20,33 @@ volatile uint32_t* get_psp() {
     return ptr;
 }
 
+void paint_main_stack() {
+    /* Keep clear of the frame of this function. */
+    volatile uint32_t* const end = get_msp() - 8;
+    for(volatile uint32_t* word = const_cast<volatile uint32_t*>(main_stack.begin()); word < end; word++) {
+        *word = stack_pattern;
+    }
+}
+
+void paint_process_stack() {
+    for(const volatile uint32_t& word : process_stack) {
+        const_cast<volatile uint32_t&>(word) = stack_pattern;
+    }
+}
+
+std::size_t get_stack_usage(const Array_wrapper<const volatile uint32_t>& stack) {
+    /* Stacks grow down, so untouched words remain at the start. */
+    const volatile uint32_t* word = stack.begin();
+    while((word != stack.end()) && (*word == stack_pattern)) {
+        word++;
+    }
+    return (static_cast<std::size_t>(stack.end() - word) * sizeof(uint32_t));
+}
+
+std::size_t get_stack_free(const Array_wrapper<const volatile uint32_t>& stack) {
+    return ((stack.size() * sizeof(uint32_t)) - get_stack_usage(stack));
+}
+
 }
 
 }
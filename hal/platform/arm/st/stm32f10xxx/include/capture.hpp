@@ -0,0 +1,190 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    capture.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Timer paced DMA sampling of GPIO ports.
+ */
+
+#ifndef BMPP_HAL_STM32F10XXX_CAPTURE_HPP__
+#define BMPP_HAL_STM32F10XXX_CAPTURE_HPP__
+
+/* System. */
+#include <array>            /* Buffers.             */
+#include <cstdint>          /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "gpio.hpp"         /* Input ports.         */
+#include "timer.hpp"        /* Pacing timer.        */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  Logic analyzer sampling all pins of a port, one IDR sample per update
+ *  event of a timer, moved by the update DMA channel of the timer into a
+ *  circular buffer. The CPU is involved once per half buffer only.
+ *
+ *  A stream hands every filled half of the buffer to a callback. A
+ *  triggered capture scans every filled half for a trigger condition and
+ *  stops once enough samples follow the trigger, keeping at least the
+ *  requested pre-trigger samples in the buffer, less the samples taken
+ *  during the interrupt latency.
+ */
+class Capture {
+public:
+
+    /**
+     *  Trigger condition on the pins of the port.
+     */
+    struct Trigger {
+        uint16_t mask;      /**< Pins compared, none to trigger at once.    */
+        uint16_t value;     /**< Levels of the compared pins.               */
+        bool     edge;      /**< Trigger on entering the condition only.    */
+    };
+
+    /**
+     *  Called from interrupt context with a filled half of a stream.
+     */
+    using Block = void (*)(const uint16_t* samples, const uint16_t& count);
+
+    /**
+     *  Called from interrupt context when a triggered capture ends.
+     */
+    using Done = void (*)();
+
+    /**
+     *  @param[in]  timer   Timer pacing the sampling.
+     */
+    explicit constexpr Capture(const Timer& timer);
+
+    /**
+     *  Samples a port continuously until stopped.
+     *  @param[in]  port        Input port.
+     *  @param[out] samples     Buffer of an even number of samples.
+     *  @param[in]  count       Number of samples in the buffer.
+     *  @param[in]  hz          Samples per second.
+     *  @param[in]  block       Called per filled half.
+     *  @return                 False when the count is zero or odd, or the
+     *                          rate can not be reached.
+     */
+    bool stream(const Gpio& port, uint16_t* samples, const uint16_t& count, const uint32_t& hz, Block block) const;
+
+    template<std::size_t N>
+    bool stream(const Gpio& port, std::array<uint16_t, N>& samples, const uint32_t& hz, Block block) const;
+
+    /**
+     *  Samples a port until a trigger condition, followed by the samples
+     *  which do not fit the pre-trigger depth.
+     *  @param[in]  port        Input port.
+     *  @param[out] samples     Buffer of an even number of samples.
+     *  @param[in]  count       Number of samples in the buffer.
+     *  @param[in]  hz          Samples per second.
+     *  @param[in]  trigger     Trigger condition.
+     *  @param[in]  pre_trigger Samples to keep before the trigger.
+     *  @param[in]  done        Called at the end, may be nullptr.
+     *  @return                 False when the count is zero or odd, or the
+     *                          rate can not be reached.
+     */
+    bool arm(const Gpio& port, uint16_t* samples, const uint16_t& count, const uint32_t& hz,
+             const Trigger& trigger, const uint16_t& pre_trigger, Done done) const;
+
+    template<std::size_t N>
+    bool arm(const Gpio& port, std::array<uint16_t, N>& samples, const uint32_t& hz,
+             const Trigger& trigger, const uint16_t& pre_trigger, Done done) const;
+
+    /**
+     *  Checks whether sampling is in progress.
+     *  @return True while sampling.
+     */
+    bool is_running() const;
+
+    /**
+     *  Checks whether the trigger condition occurred.
+     *  @return True once triggered.
+     */
+    bool is_triggered() const;
+
+    /**
+     *  Stops sampling, ordering the captured samples.
+     *  @return None.
+     */
+    void stop() const;
+
+    /**
+     *  Number of valid samples of a stopped capture.
+     *  @return Samples.
+     */
+    uint16_t get_size() const;
+
+    /**
+     *  Sample of a stopped capture in order of time.
+     *  @param[in]  index   Index, 0 for the oldest sample.
+     *  @return             Port levels.
+     */
+    uint16_t get_sample(const uint16_t& index) const;
+
+    /**
+     *  Index of the triggering sample of a stopped capture.
+     *  @return Index in order of time.
+     */
+    uint16_t get_trigger_index() const;
+
+private:
+
+    /**
+     *  Starts the DMA and the timer.
+     *  @param[in]  port        Input port.
+     *  @param[out] samples     Sample buffer.
+     *  @param[in]  count       Number of samples.
+     *  @param[in]  hz          Samples per second.
+     *  @return                 False when the rate can not be reached.
+     */
+    bool start(const Gpio& port, uint16_t* samples, const uint16_t& count, const uint32_t& hz) const;
+
+    const Timer& timer;     /**< Timer pacing the sampling. */
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+constexpr Capture::Capture(const Timer& timer) :
+    timer   (timer) {
+
+}
+
+template<std::size_t N>
+bool Capture::stream(const Gpio& port, std::array<uint16_t, N>& samples, const uint32_t& hz, Block block) const {
+    static_assert(N <= 0xFFFFUL, "Buffer exceeds a DMA transfer.");
+    static_assert((N % 2UL) == 0UL, "Capture buffer must have an even number of samples.");
+    return stream(port, samples.data(), static_cast<uint16_t>(N), hz, block);
+}
+
+template<std::size_t N>
+bool Capture::arm(const Gpio& port, std::array<uint16_t, N>& samples, const uint32_t& hz,
+                  const Trigger& trigger, const uint16_t& pre_trigger, Done done) const {
+    static_assert(N <= 0xFFFFUL, "Buffer exceeds a DMA transfer.");
+    static_assert((N % 2UL) == 0UL, "Capture buffer must have an even number of samples.");
+    return arm(port, samples.data(), static_cast<uint16_t>(N), hz, trigger, pre_trigger, done);
+}
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_STM32F10XXX_CAPTURE_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,281 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    clock_tree.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Compile-time clock tree solver.
+ */
+
+#ifndef BMPP_HAL_STM32F10XXX_CLOCK_TREE_HPP__
+#define BMPP_HAL_STM32F10XXX_CLOCK_TREE_HPP__
+
+/* System. */
+#include <cstdint>                      /* Fixed size integers. */
+
+/* Third-party. */
+
+/* Local. */
+#include "flash.hpp"                    /* Flash wait states.   */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  Reason a clock configuration can not be realised.
+ */
+enum class Clock_error {
+    none,           /**< Configuration is valid.                        */
+    hse_range,      /**< External oscillator outside 4-16 MHz.          */
+    sysclk_range,   /**< SYSCLK above 72 MHz.                           */
+    sysclk_source,  /**< No oscillator or PLL setting reaches SYSCLK.   */
+    hclk_divider,   /**< HCLK is no AHB prescaler division of SYSCLK.   */
+    pclk1_divider,  /**< PCLK1 is no APB1 prescaler division of HCLK.   */
+    pclk1_range,    /**< PCLK1 above 36 MHz.                            */
+    pclk2_divider,  /**< PCLK2 is no APB2 prescaler division of HCLK.   */
+    pclk2_range     /**< PCLK2 above 72 MHz.                            */
+};
+
+/**
+ *  Clock tree configuration, as register field codes and resulting clocks.
+ */
+struct Clock_config {
+    Clock_error error;      /**< Reason the configuration is invalid.   */
+    uint32_t    sw;         /**< System clock switch, CFGR.SW.          */
+    uint32_t    pllsrc;     /**< PLL entry clock source, CFGR.PLLSRC.   */
+    uint32_t    pllxtpre;   /**< HSE divider for PLL, CFGR.PLLXTPRE.    */
+    uint32_t    pllmul;     /**< PLL multiplication, CFGR.PLLMUL.       */
+    uint32_t    hpre;       /**< AHB prescaler, CFGR.HPRE.              */
+    uint32_t    ppre1;      /**< APB1 prescaler, CFGR.PPRE1.            */
+    uint32_t    ppre2;      /**< APB2 prescaler, CFGR.PPRE2.            */
+    uint32_t    adcpre;     /**< ADC prescaler, CFGR.ADCPRE.            */
+    uint32_t    usbpre;     /**< USB prescaler, CFGR.USBPRE.            */
+    uint32_t    latency;    /**< Flash wait states.                     */
+    uint32_t    hse;        /**< External oscillator in Hertz.          */
+    uint32_t    sysclk;     /**< System clock in Hertz.                 */
+    uint32_t    hclk;       /**< AHB clock in Hertz.                    */
+    uint32_t    pclk1;      /**< APB1 clock in Hertz.                   */
+    uint32_t    pclk2;      /**< APB2 clock in Hertz.                   */
+    uint32_t    adcclk;     /**< ADC clock in Hertz.                    */
+    uint32_t    usbclk;     /**< USB clock in Hertz, 0 if unavailable.  */
+
+    /**
+     *  Checks whether the configuration can be applied.
+     *  @return True when valid.
+     */
+    constexpr bool valid() const {
+        return (error == Clock_error::none);
+    }
+
+    /**
+     *  Clock of the timers on APB1, TIM2 to TIM7, doubled when APB1 is
+     *  divided. PPRE codes of 4 and up divide.
+     *  @return Clock in Hertz.
+     */
+    constexpr uint32_t apb1_timclk() const {
+        return (ppre1 < 4UL) ? pclk1 : (pclk1 * 2UL);
+    }
+
+    /**
+     *  Clock of the timers on APB2, TIM1 and TIM8, doubled when APB2 is
+     *  divided.
+     *  @return Clock in Hertz.
+     */
+    constexpr uint32_t apb2_timclk() const {
+        return (ppre2 < 4UL) ? pclk2 : (pclk2 * 2UL);
+    }
+};
+
+/**
+ *  Clock limits of the STM32F10xxx family.
+ */
+struct Clock_limits {
+    static const uint32_t hsi         =  8'000'000UL;   /**< Internal oscillator.       */
+    static const uint32_t hse_min     =  4'000'000UL;   /**< Minimal HSE.               */
+    static const uint32_t hse_max     = 16'000'000UL;   /**< Maximal HSE.               */
+    static const uint32_t sysclk_max  = 72'000'000UL;   /**< Maximal SYSCLK.            */
+    static const uint32_t pclk1_max   = 36'000'000UL;   /**< Maximal APB1 clock.        */
+    static const uint32_t pclk2_max   = 72'000'000UL;   /**< Maximal APB2 clock.        */
+    static const uint32_t adcclk_max  = 14'000'000UL;   /**< Maximal ADC clock.         */
+};
+
+/**
+ *  Finds the AHB prescaler code dividing a clock into a target.
+ *  @param[in]  in      Input clock in Hertz.
+ *  @param[in]  out     Requested clock in Hertz.
+ *  @return             HPRE code, or 16 when no division matches.
+ */
+constexpr uint32_t solve_hpre(const uint32_t& in, const uint32_t& out) {
+    const uint32_t divs[]  = { 1UL, 2UL, 4UL, 8UL, 16UL, 64UL, 128UL, 256UL, 512UL };
+    const uint32_t codes[] = { 0UL, 8UL, 9UL, 10UL, 11UL, 12UL, 13UL, 14UL, 15UL };
+    for(std::size_t i = 0UL; i < 9UL; i++) {
+        if(((in % divs[i]) == 0UL) && ((in / divs[i]) == out)) {
+            return codes[i];
+        }
+    }
+    return 16UL;
+}
+
+/**
+ *  Finds the APB prescaler code dividing a clock into a target.
+ *  @param[in]  in      Input clock in Hertz.
+ *  @param[in]  out     Requested clock in Hertz.
+ *  @return             PPRE code, or 8 when no division matches.
+ */
+constexpr uint32_t solve_ppre(const uint32_t& in, const uint32_t& out) {
+    for(uint32_t shift = 0UL; shift < 5UL; shift++) {
+        if(((in % (1UL << shift)) == 0UL) && ((in >> shift) == out)) {
+            return (shift == 0UL) ? 0UL : (shift + 3UL);
+        }
+    }
+    return 8UL;
+}
+
+/**
+ *  Solves the clock tree for the requested clocks.
+ *  SYSCLK is taken from HSI or HSE directly when they match, otherwise from
+ *  the PLL, preferring HSE, then HSE/2, then HSI/2 as PLL input.
+ *  @param[in]  hse     External oscillator in Hertz, 0 when absent.
+ *  @param[in]  sysclk  Requested system clock in Hertz.
+ *  @param[in]  hclk    Requested AHB clock in Hertz.
+ *  @param[in]  pclk1   Requested APB1 clock in Hertz.
+ *  @param[in]  pclk2   Requested APB2 clock in Hertz.
+ *  @return             Clock configuration, check error before use.
+ */
+constexpr Clock_config solve_clock(const uint32_t& hse, const uint32_t& sysclk, const uint32_t& hclk,
+                                   const uint32_t& pclk1, const uint32_t& pclk2) {
+    Clock_config config { Clock_error::none, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL,
+                          hse, sysclk, hclk, pclk1, pclk2, 0UL, 0UL };
+
+    if((hse != 0UL) && ((hse < Clock_limits::hse_min) || (hse > Clock_limits::hse_max))) {
+        config.error = Clock_error::hse_range;
+        return config;
+    }
+    if(sysclk > Clock_limits::sysclk_max) {
+        config.error = Clock_error::sysclk_range;
+        return config;
+    }
+
+    /* System clock source. */
+    if(sysclk == Clock_limits::hsi) {
+        config.sw = 0UL;
+    } else if((hse != 0UL) && (sysclk == hse)) {
+        config.sw = 1UL;
+    } else {
+        const uint32_t inputs[]   = { hse, static_cast<uint32_t>(hse / 2UL), static_cast<uint32_t>(Clock_limits::hsi / 2UL) };
+        const uint32_t pllsrc[]   = { 1UL, 1UL, 0UL };
+        const uint32_t pllxtpre[] = { 0UL, 1UL, 0UL };
+        bool found = false;
+        for(std::size_t i = 0UL; (i < 3UL) && !found; i++) {
+            for(uint32_t mul = 2UL; (mul <= 16UL) && !found && (inputs[i] != 0UL); mul++) {
+                if((inputs[i] * mul) == sysclk) {
+                    config.sw       = 2UL;
+                    config.pllsrc   = pllsrc[i];
+                    config.pllxtpre = pllxtpre[i];
+                    config.pllmul   = (mul - 2UL);
+                    found = true;
+                }
+            }
+        }
+        if(!found) {
+            config.error = Clock_error::sysclk_source;
+            return config;
+        }
+        /* USB needs 48 MHz, from a 48 MHz PLL directly or a 72 MHz PLL divided by 1.5. */
+        if(sysclk == 48'000'000UL) {
+            config.usbpre = 1UL;
+            config.usbclk = sysclk;
+        } else if(sysclk == 72'000'000UL) {
+            config.usbpre = 0UL;
+            config.usbclk = 48'000'000UL;
+        }
+    }
+
+    /* Bus prescalers. */
+    config.hpre = solve_hpre(sysclk, hclk);
+    if(config.hpre > 15UL) {
+        config.error = Clock_error::hclk_divider;
+        return config;
+    }
+    config.ppre1 = solve_ppre(hclk, pclk1);
+    if(config.ppre1 > 7UL) {
+        config.error = Clock_error::pclk1_divider;
+        return config;
+    }
+    if(pclk1 > Clock_limits::pclk1_max) {
+        config.error = Clock_error::pclk1_range;
+        return config;
+    }
+    config.ppre2 = solve_ppre(hclk, pclk2);
+    if(config.ppre2 > 7UL) {
+        config.error = Clock_error::pclk2_divider;
+        return config;
+    }
+    if(pclk2 > Clock_limits::pclk2_max) {
+        config.error = Clock_error::pclk2_range;
+        return config;
+    }
+
+    /* Fastest ADC clock within limits. */
+    config.adcpre = 3UL;
+    for(uint32_t code = 0UL; code < 4UL; code++) {
+        if((pclk2 / ((code + 1UL) * 2UL)) <= Clock_limits::adcclk_max) {
+            config.adcpre = code;
+            break;
+        }
+    }
+    config.adcclk = pclk2 / ((config.adcpre + 1UL) * 2UL);
+
+    /* Flash wait states. */
+    config.latency = Flash::latency(sysclk);
+
+    return config;
+}
+
+/**
+ *  Clock tree solved at compile time.
+ *  APB1 defaults to the fastest clock within its 36 MHz limit.
+ *  @tparam Sysclk  System clock in Hertz.
+ *  @tparam Hclk    AHB clock in Hertz.
+ *  @tparam Pclk1   APB1 clock in Hertz.
+ *  @tparam Pclk2   APB2 clock in Hertz.
+ *  @tparam Hse     External oscillator in Hertz, 0 when absent.
+ */
+template<uint32_t Sysclk,
+         uint32_t Hclk  = Sysclk,
+         uint32_t Pclk1 = ((Hclk > Clock_limits::pclk1_max) ? (Hclk / 2UL) : Hclk),
+         uint32_t Pclk2 = Hclk,
+#if defined(EXTCLK)
+         uint32_t Hse   = EXTCLK>
+#else
+         uint32_t Hse   = 0UL>
+#endif
+struct Clock_tree {
+
+    static constexpr Clock_config config = solve_clock(Hse, Sysclk, Hclk, Pclk1, Pclk2);
+
+    static_assert(config.error != Clock_error::hse_range,     "External oscillator must be 4-16 MHz.");
+    static_assert(config.error != Clock_error::sysclk_range,  "SYSCLK exceeds 72 MHz.");
+    static_assert(config.error != Clock_error::sysclk_source, "SYSCLK can not be derived from HSI, HSE or PLL.");
+    static_assert(config.error != Clock_error::hclk_divider,  "HCLK is no AHB prescaler division of SYSCLK.");
+    static_assert(config.error != Clock_error::pclk1_divider, "PCLK1 is no APB1 prescaler division of HCLK.");
+    static_assert(config.error != Clock_error::pclk1_range,   "PCLK1 exceeds 36 MHz.");
+    static_assert(config.error != Clock_error::pclk2_divider, "PCLK2 is no APB2 prescaler division of HCLK.");
+    static_assert(config.error != Clock_error::pclk2_range,   "PCLK2 exceeds 72 MHz.");
+
+};
+
+template<uint32_t S, uint32_t H, uint32_t P1, uint32_t P2, uint32_t E>
+constexpr Clock_config Clock_tree<S, H, P1, P2, E>::config;
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+
+#endif /* BMPP_HAL_STM32F10XXX_CLOCK_TREE_HPP__ */
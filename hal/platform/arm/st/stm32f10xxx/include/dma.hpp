@@ -0,0 +1,392 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    dma.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Direct memory access controller.
+ */
+
+#ifndef BMPP_HAL_STM32F10XXX_DMA_HPP__
+#define BMPP_HAL_STM32F10XXX_DMA_HPP__
+
+/* System. */
+#include <array>            /* Buffers.             */
+#include <cstdint>          /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "mem_access.hpp"       /* Mapped memory access. */
+#include "register_field.hpp"   /* Register bitfields.   */
+#include "irq.hpp"              /* Interrupt numbers.    */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  Channel of DMA1, moving elements between a peripheral register and
+ *  memory, or between two memory buffers.
+ *
+ *  A buffer belongs to the DMA from the start of a transfer until wait()
+ *  or stop() returns, or the complete event is reported; the caller keeps
+ *  it alive and leaves it alone meanwhile. A channel refuses to start
+ *  while busy, so a running transfer is never redirected to another
+ *  buffer, or its buffer handed out twice. In circular mode the half
+ *  transfer event marks the first half as filled or sent and the complete
+ *  event the second half, while the DMA works on the other one. Starting
+ *  and ending a transfer is a memory barrier, so buffer accesses are
+ *  neither reordered nor cached in registers across it.
+ *
+ *  Events are reported from the channel interrupt, which the driver owns.
+ */
+class Dma_channel {
+public:
+
+    static const uint32_t base_address  = 0x4002'0000UL;   /**< DMA1 registers.    */
+    static const uint8_t  channel_count = 7U;              /**< Channels of DMA1.  */
+
+    /**
+     *  Transfer mode.
+     */
+    enum class Mode : uint8_t {
+        normal   = 0,   /**< Single transfer of count elements.         */
+        circular = 1    /**< Restarts at the end of the buffer.         */
+    };
+
+    /**
+     *  Channel priority, equal priorities are served by channel number.
+     */
+    enum class Priority : uint32_t {
+        low       = 0,  /**< Low.       */
+        medium    = 1,  /**< Medium.    */
+        high      = 2,  /**< High.      */
+        very_high = 3   /**< Very high. */
+    };
+
+    /**
+     *  Transfer events, valued by their bit in the channel flags.
+     */
+    enum class Event : uint8_t {
+        complete = 1,   /**< All elements transferred.      */
+        half     = 2,   /**< Half of the elements done.     */
+        error    = 3    /**< Bus error, channel disabled.   */
+    };
+
+    /**
+     *  Called from interrupt context for every enabled event, with the
+     *  context given to set_callback().
+     */
+    using Callback = void (*)(void* context, const Event& event);
+
+    /**
+     *  Channel configuration register layout.
+     */
+    struct Ccr {
+        using en      = Field<Ccr,  0, 1, Access_policy::read_write, bool>;     /**< Channel enable.            */
+        using tcie    = Field<Ccr,  1, 1, Access_policy::read_write, bool>;     /**< Complete interrupt.        */
+        using htie    = Field<Ccr,  2, 1, Access_policy::read_write, bool>;     /**< Half transfer interrupt.   */
+        using teie    = Field<Ccr,  3, 1, Access_policy::read_write, bool>;     /**< Error interrupt.           */
+        using dir     = Field<Ccr,  4, 1, Access_policy::read_write, bool>;     /**< Read from memory.          */
+        using circ    = Field<Ccr,  5, 1, Access_policy::read_write, bool>;     /**< Circular mode.             */
+        using pinc    = Field<Ccr,  6, 1, Access_policy::read_write, bool>;     /**< Peripheral increment.      */
+        using minc    = Field<Ccr,  7, 1, Access_policy::read_write, bool>;     /**< Memory increment.          */
+        using psize   = Field<Ccr,  8, 2>;                                      /**< Peripheral element size.   */
+        using msize   = Field<Ccr, 10, 2>;                                      /**< Memory element size.       */
+        using pl      = Field<Ccr, 12, 2, Access_policy::read_write, Priority>; /**< Channel priority.          */
+        using mem2mem = Field<Ccr, 14, 1, Access_policy::read_write, bool>;     /**< Memory to memory.          */
+    };
+
+    /**
+     *  @param[in]  channel_nr  Channel number, 1 to 7.
+     */
+    explicit constexpr Dma_channel(const uint8_t& channel_nr);
+
+    /**
+     *  Reports events of the following transfers.
+     *  @param[in]  callback        Called per event, nullptr for none.
+     *  @param[in]  context         Passed to the callback.
+     *  @param[in]  half_transfer   Also report half transfer events.
+     *  @return None.
+     */
+    void set_callback(Callback callback, void* context = nullptr, const bool& half_transfer = false) const;
+
+    /**
+     *  Sets the priority of the following transfers.
+     *  @param[in]  priority    Priority.
+     *  @return None.
+     */
+    void set_priority(const Priority& priority) const;
+
+    /**
+     *  Starts moving elements from a peripheral register into memory.
+     *  @tparam     T           Element type, of 1, 2 or 4 bytes.
+     *  @param[in]  peripheral  Address of the peripheral register.
+     *  @param[out] memory      Destination buffer.
+     *  @param[in]  count       Number of elements.
+     *  @param[in]  mode        Transfer mode.
+     *  @return                 False when the channel is busy.
+     */
+    template<typename T>
+    bool receive(const uint32_t& peripheral, T* memory, const uint16_t& count, const Mode& mode = Mode::normal) const;
+
+    template<typename T, std::size_t N>
+    bool receive(const uint32_t& peripheral, std::array<T, N>& memory, const Mode& mode = Mode::normal) const;
+
+    /**
+     *  Starts reading elements from a peripheral register into a single
+     *  element, which keeps the last one, e.g. to drain frames which are
+     *  not needed.
+     *  @tparam     T           Element type, of 1, 2 or 4 bytes.
+     *  @param[in]  peripheral  Address of the peripheral register.
+     *  @param[out] sink        Element overwritten by every transfer.
+     *  @param[in]  count       Number of elements.
+     *  @return                 False when the channel is busy.
+     */
+    template<typename T>
+    bool discard(const uint32_t& peripheral, T* sink, const uint16_t& count) const;
+
+    /**
+     *  Starts moving elements from memory into a peripheral register.
+     *  @tparam     T           Element type, of 1, 2 or 4 bytes.
+     *  @param[in]  memory      Source buffer.
+     *  @param[in]  peripheral  Address of the peripheral register.
+     *  @param[in]  count       Number of elements.
+     *  @param[in]  mode        Transfer mode.
+     *  @return                 False when the channel is busy.
+     */
+    template<typename T>
+    bool transmit(const T* memory, const uint32_t& peripheral, const uint16_t& count, const Mode& mode = Mode::normal) const;
+
+    template<typename T, std::size_t N>
+    bool transmit(const std::array<T, N>& memory, const uint32_t& peripheral, const Mode& mode = Mode::normal) const;
+
+    /**
+     *  Starts copying a memory buffer, as fast as the bus allows.
+     *  @tparam     T               Element type, of 1, 2 or 4 bytes.
+     *  @param[out] destination     Destination buffer.
+     *  @param[in]  source          Source buffer.
+     *  @param[in]  count           Number of elements.
+     *  @return                     False when the channel is busy.
+     */
+    template<typename T>
+    bool copy(T* destination, const T* source, const uint16_t& count) const;
+
+    /**
+     *  Checks whether a transfer is in progress. Circular transfers remain
+     *  in progress until stopped.
+     *  @return True when busy.
+     */
+    bool is_busy() const;
+
+    /**
+     *  Checks whether the last transfer ended in a bus error, also when the
+     *  error was reported to the callback.
+     *  @return True on error.
+     */
+    bool has_error() const;
+
+    /**
+     *  Waits for the end of a normal transfer.
+     *  @return True when completed without error.
+     */
+    bool wait() const;
+
+    /**
+     *  Aborts a transfer.
+     *  @return Number of elements not transferred.
+     */
+    uint16_t stop() const;
+
+    /**
+     *  Number of elements still to be transferred in the current cycle.
+     *  @return Remaining elements.
+     */
+    uint16_t get_remaining() const;
+
+    /**
+     *  Interrupt of the channel.
+     *  @return Interrupt number.
+     */
+    constexpr Irq get_irq() const;
+
+    /**
+     *  Number of the channel.
+     *  @return Channel number, 1 to 7.
+     */
+    constexpr uint8_t get_channel_nr() const;
+
+    /**
+     *  Serves the channel interrupt.
+     *  @return None.
+     */
+    void handle_interrupt() const;
+
+private:
+
+    /**
+     *  Element size code of a type.
+     *  @tparam     T   Element type.
+     *  @return         Size code of PSIZE and MSIZE.
+     */
+    template<typename T>
+    static constexpr uint32_t size_code();
+
+    /**
+     *  Address of a buffer as seen by the DMA.
+     *  @param[in]  memory  Buffer.
+     *  @return             Bus address.
+     */
+    static uint32_t bus_address(const volatile void* memory);
+
+    /**
+     *  Configures and enables the channel, unless busy.
+     *  @param[in]  config      Transfer configuration.
+     *  @param[in]  peripheral  Peripheral side address.
+     *  @param[in]  memory      Memory side address.
+     *  @param[in]  count       Number of elements.
+     *  @return                 False when the channel is busy.
+     */
+    bool start(const Field_value<Ccr>& config, const uint32_t& peripheral, const uint32_t& memory, const uint16_t& count) const;
+
+    const uint8_t channel_nr;   /**< Channel number, 1 to 7.    */
+    const uint32_t shift;       /**< Position of the flags.     */
+
+    /**
+     *  Interrupt status register, shared by the channels.
+     *  Address offset: 0x00
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_only> isr;
+
+    /**
+     *  Interrupt flag clear register, shared by the channels.
+     *  Address offset: 0x04
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::write_only> ifcr;
+
+    /**
+     *  Channel configuration register.
+     *  Address offset: 0x08 + 20 * (channel - 1)
+     *  Reset value:    0x0000'0000
+     */
+    Field_register<Ccr> ccr;
+
+    /**
+     *  Channel number of data register.
+     *  Address offset: 0x0C + 20 * (channel - 1)
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> cndtr;
+
+    /**
+     *  Channel peripheral address register.
+     *  Address offset: 0x10 + 20 * (channel - 1)
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> cpar;
+
+    /**
+     *  Channel memory address register.
+     *  Address offset: 0x14 + 20 * (channel - 1)
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> cmar;
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+constexpr Dma_channel::Dma_channel(const uint8_t& channel_nr) :
+    channel_nr  (channel_nr),
+    shift       (4UL * (channel_nr - 1UL)),
+    isr         (base_address + 0x00UL),
+    ifcr        (base_address + 0x04UL),
+    ccr         (base_address + 0x08UL + (20UL * (channel_nr - 1UL))),
+    cndtr       (base_address + 0x0CUL + (20UL * (channel_nr - 1UL))),
+    cpar        (base_address + 0x10UL + (20UL * (channel_nr - 1UL))),
+    cmar        (base_address + 0x14UL + (20UL * (channel_nr - 1UL))) {
+
+}
+
+template<typename T>
+bool Dma_channel::receive(const uint32_t& peripheral, T* memory, const uint16_t& count, const Mode& mode) const {
+    return start(Ccr::dir::clear() | Ccr::circ::value(mode == Mode::circular) | Ccr::minc::set()
+          | Ccr::psize::value(size_code<T>()) | Ccr::msize::value(size_code<T>()),
+          peripheral, bus_address(memory), count);
+}
+
+template<typename T, std::size_t N>
+bool Dma_channel::receive(const uint32_t& peripheral, std::array<T, N>& memory, const Mode& mode) const {
+    static_assert(N <= 0xFFFFUL, "Buffer exceeds a DMA transfer.");
+    return receive(peripheral, memory.data(), static_cast<uint16_t>(N), mode);
+}
+
+template<typename T>
+bool Dma_channel::discard(const uint32_t& peripheral, T* sink, const uint16_t& count) const {
+    return start(Ccr::dir::clear() | Ccr::minc::clear()
+          | Ccr::psize::value(size_code<T>()) | Ccr::msize::value(size_code<T>()),
+          peripheral, bus_address(sink), count);
+}
+
+template<typename T>
+bool Dma_channel::transmit(const T* memory, const uint32_t& peripheral, const uint16_t& count, const Mode& mode) const {
+    return start(Ccr::dir::set() | Ccr::circ::value(mode == Mode::circular) | Ccr::minc::set()
+          | Ccr::psize::value(size_code<T>()) | Ccr::msize::value(size_code<T>()),
+          peripheral, bus_address(memory), count);
+}
+
+template<typename T, std::size_t N>
+bool Dma_channel::transmit(const std::array<T, N>& memory, const uint32_t& peripheral, const Mode& mode) const {
+    static_assert(N <= 0xFFFFUL, "Buffer exceeds a DMA transfer.");
+    return transmit(memory.data(), peripheral, static_cast<uint16_t>(N), mode);
+}
+
+template<typename T>
+bool Dma_channel::copy(T* destination, const T* source, const uint16_t& count) const {
+    /* The peripheral side is the source. */
+    return start(Ccr::dir::clear() | Ccr::mem2mem::set() | Ccr::pinc::set() | Ccr::minc::set()
+          | Ccr::psize::value(size_code<T>()) | Ccr::msize::value(size_code<T>()),
+          bus_address(source), bus_address(destination), count);
+}
+
+constexpr Irq Dma_channel::get_irq() const {
+    return static_cast<Irq>(static_cast<uint8_t>(Irq::dma1_channel1) + channel_nr - 1U);
+}
+
+constexpr uint8_t Dma_channel::get_channel_nr() const {
+    return channel_nr;
+}
+
+template<typename T>
+constexpr uint32_t Dma_channel::size_code() {
+    static_assert((sizeof(T) == 1UL) || (sizeof(T) == 2UL) || (sizeof(T) == 4UL), "Element size not supported by DMA.");
+    return (sizeof(T) == 1UL) ? 0UL : ((sizeof(T) == 2UL) ? 1UL : 2UL);
+}
+
+} /* namespace stm32f10xxx */
+
+constexpr stm32f10xxx::Dma_channel dma1_channel1(1U);
+constexpr stm32f10xxx::Dma_channel dma1_channel2(2U);
+constexpr stm32f10xxx::Dma_channel dma1_channel3(3U);
+constexpr stm32f10xxx::Dma_channel dma1_channel4(4U);
+constexpr stm32f10xxx::Dma_channel dma1_channel5(5U);
+constexpr stm32f10xxx::Dma_channel dma1_channel6(6U);
+constexpr stm32f10xxx::Dma_channel dma1_channel7(7U);
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_STM32F10XXX_DMA_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,257 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    exti.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   External interrupt/event controller.
+ */
+
+#ifndef BMPP_HAL_STM32F10XXX_EXTI_HPP__
+#define BMPP_HAL_STM32F10XXX_EXTI_HPP__
+
+/* System. */
+#include <cstdint>          /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "mem_access.hpp"   /* Mapped memory access.    */
+#include "gpio.hpp"         /* Pin ports.               */
+#include "irq.hpp"          /* Interrupt numbers.       */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  Edge detection of GPIO inputs, raising an interrupt or an event.
+ *  Line n is connected to pin n of one selectable port. Interrupts are
+ *  dispatched to a callback per line. The driver owns
+ *  exti0_handler to exti4_handler, exti9_5_handler and exti15_10_handler.
+ *  The shared handlers serve the pending lines in ascending order.
+ */
+class Exti {
+public:
+
+    static const uint32_t base_address = 0x4001'0400UL;    /**< EXTI registers.            */
+    static const uint32_t afio_address = 0x4001'0000UL;    /**< AFIO registers, EXTICR1.   */
+    static const uint8_t  line_count   = 16U;              /**< Lines connected to GPIO.   */
+
+    /**
+     *  Edges to detect.
+     */
+    enum class Edge : uint8_t {
+        rising  = 1,    /**< Low to high transition.    */
+        falling = 2,    /**< High to low transition.    */
+        both    = 3     /**< Any transition.            */
+    };
+
+    /**
+     *  Called from interrupt context with the line which detected an edge.
+     */
+    using Callback = void (*)(const uint8_t& line);
+
+    constexpr Exti();
+
+    /**
+     *  Raises an interrupt on edges of a pin.
+     *  @param[in]  port_nr     Port number, 0 for port A.
+     *  @param[in]  line        Pin number, which is the line.
+     *  @param[in]  edge        Edges to detect.
+     *  @param[in]  callback    Called on every edge, may be nullptr.
+     *  @return None.
+     */
+    void enable_interrupt(const uint8_t& port_nr, const uint8_t& line, const Edge& edge, Callback callback) const;
+
+    /**
+     *  Raises an interrupt on edges of a pin.
+     *  @tparam     Pin         Static pin.
+     *  @param[in]  edge        Edges to detect.
+     *  @param[in]  callback    Called on every edge, may be nullptr.
+     *  @return None.
+     */
+    template<class Pin>
+    void enable_interrupt(const Edge& edge, Callback callback) const;
+
+    /**
+     *  Raises an event, e.g. to end WFE, on edges of a pin.
+     *  @param[in]  port_nr     Port number, 0 for port A.
+     *  @param[in]  line        Pin number, which is the line.
+     *  @param[in]  edge        Edges to detect.
+     *  @return None.
+     */
+    void enable_event(const uint8_t& port_nr, const uint8_t& line, const Edge& edge) const;
+
+    /**
+     *  Raises an event on edges of a pin.
+     *  @tparam     Pin         Static pin.
+     *  @param[in]  edge        Edges to detect.
+     *  @return None.
+     */
+    template<class Pin>
+    void enable_event(const Edge& edge) const;
+
+    /**
+     *  Stops edge detection of a line, disabling the EXTI interrupt when no
+     *  other line uses it.
+     *  @param[in]  line    Line.
+     *  @return None.
+     */
+    void disable(const uint8_t& line) const;
+
+    /**
+     *  Raises the interrupt or event of a line by software.
+     *  @param[in]  line    Line.
+     *  @return None.
+     */
+    void trigger(const uint8_t& line) const;
+
+    /**
+     *  Checks whether a line detected an edge which is not yet served.
+     *  @param[in]  line    Line.
+     *  @return             True when pending.
+     */
+    bool is_pending(const uint8_t& line) const;
+
+    /**
+     *  Clears a pending edge.
+     *  @param[in]  line    Line.
+     *  @return None.
+     */
+    void clear_pending(const uint8_t& line) const;
+
+    /**
+     *  Interrupt serving a line.
+     *  @param[in]  line    Line.
+     *  @return             Interrupt number.
+     */
+    static constexpr Irq get_irq(const uint8_t& line);
+
+    /**
+     *  Lines served by an interrupt.
+     *  @param[in]  line    Line.
+     *  @return             Bitmask of the lines sharing the interrupt.
+     */
+    static constexpr uint32_t get_group(const uint8_t& line);
+
+private:
+
+    /**
+     *  Port number of a static pin.
+     *  @tparam     Pin     Static pin.
+     *  @return             Port number.
+     */
+    template<class Pin>
+    static constexpr uint8_t get_port_nr();
+
+    /**
+     *  Connects a port to a line and selects the edges.
+     *  @param[in]  port_nr     Port number.
+     *  @param[in]  line        Line.
+     *  @param[in]  edge        Edges to detect.
+     *  @return None.
+     */
+    void select(const uint8_t& port_nr, const uint8_t& line, const Edge& edge) const;
+
+    /**
+     *  Interrupt mask register.
+     *  Address offset: 0x00
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> imr;
+
+    /**
+     *  Event mask register.
+     *  Address offset: 0x04
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> emr;
+
+    /**
+     *  Rising trigger selection register.
+     *  Address offset: 0x08
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> rtsr;
+
+    /**
+     *  Falling trigger selection register.
+     *  Address offset: 0x0C
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> ftsr;
+
+    /**
+     *  Software interrupt event register.
+     *  Address offset: 0x10
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> swier;
+
+    /**
+     *  Pending register, cleared by writing 1. Never accessed by bit-band,
+     *  as its read-modify-write would clear all pending lines.
+     *  Address offset: 0x14
+     *  Reset value:    0x0000'XXXX
+     */
+    Memory_register<Access_policy::read_write> pr;
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+constexpr Exti::Exti() :
+    imr     (base_address + 0x00UL),
+    emr     (base_address + 0x04UL),
+    rtsr    (base_address + 0x08UL),
+    ftsr    (base_address + 0x0CUL),
+    swier   (base_address + 0x10UL),
+    pr      (base_address + 0x14UL) {
+
+}
+
+template<class Pin>
+void Exti::enable_interrupt(const Edge& edge, Callback callback) const {
+    static_assert(Pin::number() < line_count, "Pin has no EXTI line.");
+    enable_interrupt(get_port_nr<Pin>(), Pin::number(), edge, callback);
+}
+
+template<class Pin>
+void Exti::enable_event(const Edge& edge) const {
+    static_assert(Pin::number() < line_count, "Pin has no EXTI line.");
+    enable_event(get_port_nr<Pin>(), Pin::number(), edge);
+}
+
+constexpr Irq Exti::get_irq(const uint8_t& line) {
+    return (line < 5U) ? static_cast<Irq>(static_cast<uint8_t>(Irq::exti0) + line)
+                       : ((line < 10U) ? Irq::exti9_5 : Irq::exti15_10);
+}
+
+constexpr uint32_t Exti::get_group(const uint8_t& line) {
+    return (line < 5U) ? (1UL << line) : ((line < 10U) ? 0x03E0UL : 0xFC00UL);
+}
+
+template<class Pin>
+constexpr uint8_t Exti::get_port_nr() {
+    return static_cast<uint8_t>((Pin::address() - Gpio::base_address) / Gpio::block_size);
+}
+
+} /* namespace stm32f10xxx */
+
+constexpr stm32f10xxx::Exti exti;
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_STM32F10XXX_EXTI_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
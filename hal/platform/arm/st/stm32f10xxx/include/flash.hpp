@@ -2,6 +2,7 @@
 #define BMPP_HAL_STM32F10XXX_FLASH_HPP__
 
 #include "mem_access.hpp"
+#include "register_field.hpp"
 
 namespace bmpp {
 
@@ -14,13 +15,57 @@ public:
 
     static const uint32_t base_address = 0x4002'2000;   /**< Base address of peripheral. */
 
+    /**
+     *  Access control register layout.
+     */
+    struct Acr {
+        using latency = Field<Acr, 0, 3>;                                   /**< Wait states.           */
+        using hlfcya  = Field<Acr, 3, 1, Access_policy::read_write, bool>;  /**< Half cycle access.     */
+        using prftbe  = Field<Acr, 4, 1, Access_policy::read_write, bool>;  /**< Prefetch enable.       */
+        using prftbs  = Field<Acr, 5, 1, Access_policy::read_only,  bool>;  /**< Prefetch status.       */
+    };
+
+    static const uint32_t latency0_max   = 24'000'000UL;    /**< Maximal SYSCLK at 0 wait states.  */
+    static const uint32_t latency1_max   = 48'000'000UL;    /**< Maximal SYSCLK at 1 wait state.   */
+    static const uint32_t half_cycle_max =  8'000'000UL;    /**< Maximal SYSCLK for half cycles.   */
+
     constexpr Flash();
 
+    /**
+     *  Number of wait states needed at a system clock.
+     *  @param[in]  sysclk  System clock in Hertz.
+     *  @return             Wait states.
+     */
+    static constexpr uint8_t latency(const uint32_t& sysclk);
+
+    /**
+     *  Checks whether half cycle access may be used, which requires a low
+     *  system clock without AHB prescaler.
+     *  @param[in]  sysclk  System clock in Hertz.
+     *  @param[in]  hclk    AHB clock in Hertz.
+     *  @return             True when half cycle access is allowed.
+     */
+    static constexpr bool half_cycle(const uint32_t& sysclk, const uint32_t& hclk);
+
+    /**
+     *  Configures wait states, half cycle access and prefetch buffer in a
+     *  single update for a system clock. The prefetch buffer is enabled
+     *  unless half cycle access is used; it can only be switched while the
+     *  system clock is below 24 MHz.
+     *  @param[in]  sysclk      System clock in Hertz.
+     *  @param[in]  half_cycle  Use half cycle access, when allowed.
+     *  @return None.
+     */
+    void config(const uint32_t& sysclk, const bool& half_cycle = false) const;
+
     void set_latency(const uint8_t& latency) const;
+    uint8_t get_latency() const;
+    bool is_half_cycle() const;
+    bool is_prefetching() const;
 
 private:
 
-    Memory_register<Access_policy::read_write> acr;     /**< Access control register.   */
+    Field_register<Acr>                        acr;     /**< Access control register.   */
     Memory_register<Access_policy::write_only> keyr;    /**< PEC key register.          */
     Memory_register<Access_policy::write_only> optkeyr; /**< OPT key register.          */
     Memory_register<Access_policy::read_write> sr;      /**< Status register.           */
@@ -46,6 +91,14 @@ constexpr Flash::Flash() :
 
 }
 
+constexpr uint8_t Flash::latency(const uint32_t& sysclk) {
+    return (sysclk <= latency0_max) ? 0U : ((sysclk <= latency1_max) ? 1U : 2U);
+}
+
+constexpr bool Flash::half_cycle(const uint32_t& sysclk, const uint32_t& hclk) {
+    return ((sysclk <= half_cycle_max) && (hclk == sysclk));
+}
+
 } /* namespace stm32f10xxx */
 
 constexpr stm32f10xxx::Flash flash;
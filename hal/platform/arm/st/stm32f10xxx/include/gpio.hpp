@@ -18,6 +18,7 @@
 /* Local. */
 #include "mem_access.hpp"
 #include "pinset_base.hpp"
+#include "register_transaction.hpp"
 
 namespace bmpp {
 
@@ -34,17 +35,49 @@ public:
     explicit constexpr Gpio(const uint32_t& address);
 
     void initialize() const;
-    void set_pin_state(const uint8_t& pin, const Pin::State& state) const;
+    inline void set_pin_state(const uint8_t& pin, const Pin::State& state) const;
     void config_pin(const uint8_t& pin, const Pin::Config& config) const;
-    Pin::State get_pin_state(const uint8_t& pin) const;
+    void config_pins(const uint32_t& pins, const Pin::Config& config) const;
+
+    template<std::size_t N>
+    void config_pin(Register_transaction<N>& transaction, const uint8_t& pin, const Pin::Config& config) const;
+
+    template<std::size_t N>
+    void config_pins(Register_transaction<N>& transaction, const uint32_t& pins, const Pin::Config& config) const;
+
+    inline Pin::State get_pin_state(const uint8_t& pin) const;
+    inline void set_pins(const uint32_t& pins) const;
+    inline void clear_pins(const uint32_t& pins) const;
+    inline void toggle_pins(const uint32_t& pins) const;
+    inline void write_pins(const uint32_t& set_mask, const uint32_t& clear_mask) const;
+    inline uint32_t read_pins() const;
     uint32_t get_identifier() const;
 
+    /**
+     *  Address of the bit set/reset register, e.g. as DMA destination.
+     *  @return Register address.
+     */
+    constexpr uint32_t get_bsrr_address() const;
+
+    /**
+     *  Address of the input data register, e.g. as DMA source.
+     *  @return Register address.
+     */
+    constexpr uint32_t get_idr_address() const;
+
 private:
 
     static const uint32_t pin_count = 15UL;
 
     const uint32_t address;
 
+    /**
+     *  Mode and configuration bits of a pin in the configuration registers.
+     *  @param[in]  config  Pin configuration.
+     *  @return             Four bit configuration.
+     */
+    static constexpr uint32_t config_bits(const Pin::Config& config);
+
     /**
      *  Port configuration register low.
      *  Address offset: 0x00
@@ -108,11 +141,108 @@ constexpr Gpio::Gpio(const uint32_t & address) :
 
 }
 
+constexpr uint32_t Gpio::config_bits(const Pin::Config& config) {
+    switch(config) {
+    case Pin::Config::output_pushpull:
+        return 2UL;
+    case Pin::Config::output_opendrain:
+        return 6UL;
+    case Pin::Config::alternate_pushpull:
+        return 11UL;
+    case Pin::Config::alternate_opendrain:
+        return 15UL;
+    case Pin::Config::input_analog:
+        return 0UL;
+    case Pin::Config::input_pull:
+        return 8UL;
+    case Pin::Config::input_floating:
+    default:
+        return 4UL;
+    }
+}
+
+constexpr uint32_t Gpio::get_bsrr_address() const {
+    return bsrr.get_address();
+}
+
+constexpr uint32_t Gpio::get_idr_address() const {
+    return idr.get_address();
+}
+
+inline void Gpio::set_pin_state(const uint8_t& pin, const Pin::State& state) const {
+    if(state == Pin::State::high) {
+        bsrr = (1UL << pin);
+    } else {
+        brr = (1UL << pin);
+    }
+}
+
+inline Gpio::Pin::State Gpio::get_pin_state(const uint8_t& pin) const {
+    return static_cast<Pin::State>((idr >> pin) & 1U);
+}
+
+inline void Gpio::set_pins(const uint32_t& pins) const {
+    bsrr = (pins & 0xFFFFUL);
+}
+
+inline void Gpio::clear_pins(const uint32_t& pins) const {
+    brr = (pins & 0xFFFFUL);
+}
+
+inline void Gpio::toggle_pins(const uint32_t& pins) const {
+    /* Set the pins which are low and reset the pins which are high. Not
+     * atomic: only the BSRR store is, it never touches the other pins. */
+    const uint32_t state = (odr & pins & 0xFFFFUL);
+    bsrr = ((state << 16UL) | (~state & pins & 0xFFFFUL));
+}
+
+inline void Gpio::write_pins(const uint32_t& set_mask, const uint32_t& clear_mask) const {
+    bsrr = (((clear_mask & 0xFFFFUL) << 16UL) | (set_mask & 0xFFFFUL));
+}
+
+inline uint32_t Gpio::read_pins() const {
+    return (idr & 0xFFFFUL);
+}
+
+template<std::size_t N>
+void Gpio::config_pin(Register_transaction<N>& transaction, const uint8_t& pin, const Pin::Config& config) const {
+    config_pins(transaction, (1UL << pin), config);
+}
+
+template<std::size_t N>
+void Gpio::config_pins(Register_transaction<N>& transaction, const uint32_t& pins, const Pin::Config& config) const {
+    const uint32_t bits = config_bits(config);
+    uint32_t low_mask = 0UL;
+    uint32_t high_mask = 0UL;
+    for(uint32_t pin_nr = 0UL; pin_nr < 8UL; pin_nr++) {
+        if(pins & (1UL << pin_nr)) {
+            low_mask |= (15UL << (pin_nr * 4UL));
+        }
+        if(pins & (1UL << (pin_nr + 8UL))) {
+            high_mask |= (15UL << (pin_nr * 4UL));
+        }
+    }
+    if(low_mask) {
+        transaction.modify(crl, low_mask, (bits * 0x1111'1111UL));
+    }
+    if(high_mask) {
+        transaction.modify(crh, high_mask, (bits * 0x1111'1111UL));
+    }
+}
+
 } /* namespace stm32f10xxx */
 
 using Pinset = stm32f10xxx::Gpio;
 using Pin = Pinset::Pin;
 
+/**
+ *  Pin with port and number fixed at compile time.
+ *  @tparam Port    Port number, 0 for port A.
+ *  @tparam Pin_nr  Pin number in the port.
+ */
+template<uint8_t Port, uint8_t Pin_nr>
+using Static_pin = Static_pin_base<Pinset, (Pinset::base_address + (Pinset::block_size * Port)), Pin_nr>;
+
 constexpr Pinset gpio_a(Pinset::base_address + (Pinset::block_size * 0x00UL));
 constexpr Pinset gpio_b(Pinset::base_address + (Pinset::block_size * 0x01UL));
 constexpr Pinset gpio_c(Pinset::base_address + (Pinset::block_size * 0x02UL));
@@ -0,0 +1,359 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    i2c.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Inter-integrated circuit bus master.
+ */
+
+#ifndef BMPP_HAL_STM32F10XXX_I2C_HPP__
+#define BMPP_HAL_STM32F10XXX_I2C_HPP__
+
+/* System. */
+#include <array>            /* Buffers.             */
+#include <cstdint>          /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "mem_access.hpp"       /* Mapped memory access. */
+#include "register_field.hpp"   /* Register bitfields.   */
+#include "rcc.hpp"              /* Peripheral clocks.    */
+#include "gpio.hpp"             /* Bus pins.             */
+#include "irq.hpp"              /* Interrupt numbers.    */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  I2C master running queued requests as a state machine in its event and
+ *  error interrupts, which the driver owns. A request writes bytes to a
+ *  device, reads bytes from it, or writes and then reads after a repeated
+ *  start, e.g. to read registers. The caller only waits when it chooses
+ *  to.
+ *
+ *  A request queued in time follows the previous one with a repeated
+ *  start, so the interrupts never wait for the bus. A request queued
+ *  while the stop condition of the previous one is generated, e.g. from
+ *  its done callback, waits up to one clock period for it. A request
+ *  which still finds the stop condition, or a busy bus, e.g. after a bus
+ *  error, is started from thread context by the next is_busy(), wait()
+ *  or transfer(). A bus held busy by a device, e.g. holding SDA low after
+ *  a reset, is freed there by clocking SCL by hand and sending a stop
+ *  condition. This assumes a single master and a started timebase.
+ */
+class I2c {
+public:
+
+    /**
+     *  State of a request.
+     */
+    enum class Status : uint8_t {
+        idle,               /**< Not submitted.                 */
+        pending,            /**< Queued or in progress.         */
+        done,               /**< Completed.                     */
+        nack,               /**< Not acknowledged.              */
+        arbitration_lost,   /**< Another master took the bus.   */
+        bus_error           /**< Misplaced start or stop.       */
+    };
+
+    /**
+     *  Control register 1 layout.
+     */
+    struct Cr1 {
+        using pe    = Field<Cr1,  0, 1, Access_policy::read_write, bool>;  /**< Peripheral enable.     */
+        using start = Field<Cr1,  8, 1, Access_policy::read_write, bool>;  /**< Start generation.      */
+        using stop  = Field<Cr1,  9, 1, Access_policy::read_write, bool>;  /**< Stop generation.       */
+        using ack   = Field<Cr1, 10, 1, Access_policy::read_write, bool>;  /**< Acknowledge enable.    */
+        using pos   = Field<Cr1, 11, 1, Access_policy::read_write, bool>;  /**< Acknowledge next byte. */
+        using swrst = Field<Cr1, 15, 1, Access_policy::read_write, bool>;  /**< Software reset.        */
+    };
+
+    /**
+     *  Control register 2 layout.
+     */
+    struct Cr2 {
+        using freq    = Field<Cr2,  0, 6, Access_policy::read_write>;          /**< PCLK1 in MHz.          */
+        using iterren = Field<Cr2,  8, 1, Access_policy::read_write, bool>;    /**< Error interrupt.       */
+        using itevten = Field<Cr2,  9, 1, Access_policy::read_write, bool>;    /**< Event interrupt.       */
+        using itbufen = Field<Cr2, 10, 1, Access_policy::read_write, bool>;    /**< Buffer interrupt.      */
+    };
+
+    /**
+     *  Status register 1 layout.
+     */
+    struct Sr1 {
+        using sb      = Field<Sr1,  0, 1, Access_policy::read_only, bool>;     /**< Start sent.            */
+        using addr    = Field<Sr1,  1, 1, Access_policy::read_only, bool>;     /**< Address acknowledged.  */
+        using btf     = Field<Sr1,  2, 1, Access_policy::read_only, bool>;     /**< Byte transfer done.    */
+        using rxne    = Field<Sr1,  6, 1, Access_policy::read_only, bool>;     /**< Data received.         */
+        using txe     = Field<Sr1,  7, 1, Access_policy::read_only, bool>;     /**< Data register empty.   */
+        using berr    = Field<Sr1,  8, 1, Access_policy::read_write, bool>;    /**< Bus error.             */
+        using arlo    = Field<Sr1,  9, 1, Access_policy::read_write, bool>;    /**< Arbitration lost.      */
+        using af      = Field<Sr1, 10, 1, Access_policy::read_write, bool>;    /**< Acknowledge failure.   */
+        using ovr     = Field<Sr1, 11, 1, Access_policy::read_write, bool>;    /**< Overrun.               */
+        using timeout = Field<Sr1, 14, 1, Access_policy::read_write, bool>;    /**< SCL held too long.     */
+    };
+
+    /**
+     *  Status register 2 layout.
+     */
+    struct Sr2 {
+        using msl  = Field<Sr2, 0, 1, Access_policy::read_only, bool>;     /**< Master mode.           */
+        using busy = Field<Sr2, 1, 1, Access_policy::read_only, bool>;     /**< Bus busy.              */
+    };
+
+    struct Request;
+
+    /**
+     *  Called from interrupt context when a request ended.
+     */
+    using Done = void (*)(Request& request);
+
+    /**
+     *  Write, read, or write and read after a repeated start. Owned by the
+     *  driver, with its buffers, from submit() until no longer pending.
+     */
+    struct Request {
+        uint8_t          address;   /**< 7 bit device address.              */
+        const uint8_t*   tx;        /**< Bytes to write first.              */
+        uint16_t         tx_count;  /**< Number of bytes to write.          */
+        uint8_t*         rx;        /**< Bytes read next.                   */
+        uint16_t         rx_count;  /**< Number of bytes to read.           */
+        Done             done;      /**< Called at the end, or nullptr.     */
+        volatile Status  status;    /**< State of the request.              */
+        Request*         next;      /**< Next in the queue.                 */
+    };
+
+    /**
+     *  @param[in]  index       Index of the port, 0 for I2C1.
+     *  @param[in]  address     Base address of the port.
+     *  @param[in]  peripheral  Clock enable of the port.
+     *  @param[in]  port        Port of the bus pins.
+     *  @param[in]  scl         Clock pin.
+     *  @param[in]  sda         Data pin.
+     *  @param[in]  event_irq   Event interrupt.
+     *  @param[in]  error_irq   Error interrupt.
+     */
+    constexpr I2c(const uint8_t& index, const uint32_t& address, const Rcc::Peripheral& peripheral,
+                  const Gpio& port, const uint8_t& scl, const uint8_t& sda,
+                  const Irq& event_irq, const Irq& error_irq);
+
+    /**
+     *  Configures the bus pins and enables the port, in standard mode up to
+     *  100 kHz and fast mode up to 400 kHz, not exceeding the requested
+     *  clock.
+     *  @param[in]  hz  Maximum clock rate.
+     *  @return         False when the rate or PCLK1 is out of range.
+     */
+    bool initialize(const uint32_t& hz) const;
+
+    /**
+     *  Queues a request, starting it when the bus is free.
+     *  @param[in]  request Request, owned until no longer pending.
+     *  @return             False when still pending.
+     */
+    bool submit(Request& request) const;
+
+    /**
+     *  Runs a request and waits for its end, from thread context.
+     *  @param[in]  address     7 bit device address.
+     *  @param[in]  tx          Bytes to write first.
+     *  @param[in]  tx_count    Number of bytes to write.
+     *  @param[out] rx          Bytes read next.
+     *  @param[in]  rx_count    Number of bytes to read.
+     *  @return                 Final state of the request.
+     */
+    Status transfer(const uint8_t& address, const uint8_t* tx, const uint16_t& tx_count,
+                    uint8_t* rx = nullptr, const uint16_t& rx_count = 0U) const;
+
+    template<std::size_t N, std::size_t M>
+    Status transfer(const uint8_t& address, const std::array<uint8_t, N>& tx, std::array<uint8_t, M>& rx) const;
+
+    /**
+     *  Checks whether requests are queued or in progress, from thread
+     *  context, starting a queue waiting for the bus.
+     *  @return True while busy.
+     */
+    bool is_busy() const;
+
+    /**
+     *  Waits until all queued requests ended, from thread context.
+     *  @return None.
+     */
+    void wait() const;
+
+    /**
+     *  Serves the event interrupt.
+     *  @return None.
+     */
+    void handle_event() const;
+
+    /**
+     *  Serves the error interrupt.
+     *  @return None.
+     */
+    void handle_error() const;
+
+private:
+
+    /**
+     *  Starts a queue waiting for the bus, waiting for the stop condition
+     *  and recovering a busy bus. Only called from thread context.
+     *  @return None.
+     */
+    void resume() const;
+
+    /**
+     *  Generates the start condition of a request when the bus is free,
+     *  waiting up to one clock period for a stop condition to end.
+     *  @param[in]  request Request at the head of the queue.
+     *  @return             False while a stop condition is generated or
+     *                      the bus is busy.
+     */
+    bool start(const Request& request) const;
+
+    /**
+     *  Resets the progress for a request about to start.
+     *  @param[in]  request Request at the head of the queue.
+     *  @return None.
+     */
+    void prepare(const Request& request) const;
+
+    /**
+     *  Ends the transfer of the request in progress on the bus, by a
+     *  repeated start when another request is queued, a stop otherwise.
+     *  @return None.
+     */
+    void release() const;
+
+    /**
+     *  Ends the request in progress, preparing the next one.
+     *  @param[in]  status  Final state of the request.
+     *  @return None.
+     */
+    void finish(const Status& status) const;
+
+    /**
+     *  Resets the peripheral, keeping its configuration.
+     *  @return None.
+     */
+    void reset() const;
+
+    /**
+     *  Frees a bus held by a device by clocking SCL until SDA is released
+     *  and sending a stop condition, then resets the peripheral.
+     *  @return None.
+     */
+    void recover() const;
+
+    const uint8_t         index;        /**< Index of the port.         */
+    const Rcc::Peripheral peripheral;   /**< Clock enable of the port.  */
+    const Gpio&           port;         /**< Port of the bus pins.      */
+    const uint8_t         scl;          /**< Clock pin.                 */
+    const uint8_t         sda;          /**< Data pin.                  */
+    const Irq             event_irq;    /**< Event interrupt.           */
+    const Irq             error_irq;    /**< Error interrupt.           */
+
+    /**
+     *  Control register 1.
+     *  Address offset: 0x00
+     *  Reset value:    0x0000'0000
+     */
+    Field_register<Cr1> cr1;
+
+    /**
+     *  Control register 2.
+     *  Address offset: 0x04
+     *  Reset value:    0x0000'0000
+     */
+    Field_register<Cr2> cr2;
+
+    /**
+     *  Data register.
+     *  Address offset: 0x10
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> dr;
+
+    /**
+     *  Status register 1.
+     *  Address offset: 0x14
+     *  Reset value:    0x0000'0000
+     */
+    Field_register<Sr1> sr1;
+
+    /**
+     *  Status register 2.
+     *  Address offset: 0x18
+     *  Reset value:    0x0000'0000
+     */
+    Field_register<Sr2, Access_policy::read_only> sr2;
+
+    /**
+     *  Clock control register.
+     *  Address offset: 0x1C
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> ccr;
+
+    /**
+     *  Rise time register.
+     *  Address offset: 0x20
+     *  Reset value:    0x0000'0002
+     */
+    Memory_register<Access_policy::read_write> trise;
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+constexpr I2c::I2c(const uint8_t& index, const uint32_t& address, const Rcc::Peripheral& peripheral,
+                   const Gpio& port, const uint8_t& scl, const uint8_t& sda,
+                   const Irq& event_irq, const Irq& error_irq) :
+    index       (index),
+    peripheral  (peripheral),
+    port        (port),
+    scl         (scl),
+    sda         (sda),
+    event_irq   (event_irq),
+    error_irq   (error_irq),
+    cr1         (address + 0x00UL),
+    cr2         (address + 0x04UL),
+    dr          (address + 0x10UL),
+    sr1         (address + 0x14UL),
+    sr2         (address + 0x18UL),
+    ccr         (address + 0x1CUL),
+    trise       (address + 0x20UL) {
+
+}
+
+template<std::size_t N, std::size_t M>
+I2c::Status I2c::transfer(const uint8_t& address, const std::array<uint8_t, N>& tx, std::array<uint8_t, M>& rx) const {
+    static_assert((N <= 0xFFFFUL) && (M <= 0xFFFFUL), "Buffer exceeds a request.");
+    return transfer(address, tx.data(), static_cast<uint16_t>(N), rx.data(), static_cast<uint16_t>(M));
+}
+
+} /* namespace stm32f10xxx */
+
+constexpr stm32f10xxx::I2c i2c1(0U, 0x4000'5400UL, stm32f10xxx::Rcc::Peripheral::i2c1, gpio_b, 6U, 7U,
+                                stm32f10xxx::Irq::i2c1_ev, stm32f10xxx::Irq::i2c1_er);
+constexpr stm32f10xxx::I2c i2c2(1U, 0x4000'5800UL, stm32f10xxx::Rcc::Peripheral::i2c2, gpio_b, 10U, 11U,
+                                stm32f10xxx::Irq::i2c2_ev, stm32f10xxx::Irq::i2c2_er);
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_STM32F10XXX_I2C_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
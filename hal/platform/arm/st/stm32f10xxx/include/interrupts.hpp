@@ -3,6 +3,8 @@
 
 #include <cstdint>
 
+#include "irq.hpp"
+
 namespace bmpp {
 
 namespace hal {
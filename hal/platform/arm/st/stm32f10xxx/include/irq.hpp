@@ -0,0 +1,111 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    irq.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   STM32F10xxx interrupt numbers and interrupt controller.
+ */
+
+#ifndef BMPP_HAL_STM32F10XXX_IRQ_HPP__
+#define BMPP_HAL_STM32F10XXX_IRQ_HPP__
+
+/* System. */
+#include <cstdint>          /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "nvic.hpp"         /* Interrupt controller. */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  Device interrupt numbers, matching the handlers of interrupts.hpp and
+ *  their position in the vector table.
+ */
+enum class Irq : uint8_t {
+    wwdg            =  0,
+    pvd             =  1,
+    tamper          =  2,
+    rtc             =  3,
+    flash           =  4,
+    rcc             =  5,
+    exti0           =  6,
+    exti1           =  7,
+    exti2           =  8,
+    exti3           =  9,
+    exti4           = 10,
+    dma1_channel1   = 11,
+    dma1_channel2   = 12,
+    dma1_channel3   = 13,
+    dma1_channel4   = 14,
+    dma1_channel5   = 15,
+    dma1_channel6   = 16,
+    dma1_channel7   = 17,
+    adc1_2          = 18,
+    usb_hp_can_tx   = 19,
+    usb_lp_can_rx0  = 20,
+    can_rx1         = 21,
+    can_sce         = 22,
+    exti9_5         = 23,
+    tim1_brk        = 24,
+    tim1_up         = 25,
+    tim1_trg_com    = 26,
+    tim1_cc         = 27,
+    tim2            = 28,
+    tim3            = 29,
+    tim4            = 30,
+    i2c1_ev         = 31,
+    i2c1_er         = 32,
+    i2c2_ev         = 33,
+    i2c2_er         = 34,
+    spi1            = 35,
+    spi2            = 36,
+    usart1          = 37,
+    usart2          = 38,
+    usart3          = 39,
+    exti15_10       = 40,
+    rtc_alarm       = 41,
+    usb_wakeup      = 42,
+    tim8_brk        = 43,
+    tim8_up         = 44,
+    tim8_trg_com    = 45,
+    tim8_cc         = 46,
+    adc3            = 47,
+    fsmc            = 48,
+    sdio            = 49,
+    tim5            = 50,
+    spi3            = 51,
+    uart4           = 52,
+    uart5           = 53,
+    tim6            = 54,
+    tim7            = 55,
+    dma2_channel1   = 56,
+    dma2_channel2   = 57,
+    dma2_channel3   = 58,
+    dma2_channel4_5 = 59
+};
+
+static const uint8_t irq_count = 60U;   /**< Number of device interrupts. */
+
+using Nvic = cortex_m3::Nvic<4>;        /**< NVIC with 16 priority levels. */
+
+} /* namespace stm32f10xxx */
+
+constexpr stm32f10xxx::Nvic nvic;
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_STM32F10XXX_IRQ_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
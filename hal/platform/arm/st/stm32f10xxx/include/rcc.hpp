@@ -16,6 +16,8 @@
 
 /* Local. */
 #include "mem_access.hpp"               /* Mapped memory access. */
+#include "register_field.hpp"           /* Register bitfields.   */
+#include "clock_tree.hpp"               /* Clock tree solver.    */
 
 
 namespace bmpp {
@@ -29,16 +31,161 @@ public:
 
     static const uint32_t base_address = 0x4002'1000;
 
+    /**
+     *  PLL entry clock source.
+     */
+    enum class Pll_source : uint32_t {
+        hsi_div2 = 0,   /**< HSI oscillator divided by two. */
+        hse      = 1    /**< HSE oscillator.                */
+    };
+
+    /**
+     *  System clock source.
+     */
+    enum class Sysclk_source : uint32_t {
+        hsi = 0,    /**< HSI oscillator.    */
+        hse = 1,    /**< HSE oscillator.    */
+        pll = 2     /**< PLL output.        */
+    };
+
+    /**
+     *  Peripheral clock enable, encoded as bus (bits 8..9) and enable bit.
+     */
+    enum class Peripheral : uint32_t {
+        dma1   = 0x000,     /**< AHB, DMA1.                 */
+        dma2   = 0x001,     /**< AHB, DMA2.                 */
+        crc    = 0x006,     /**< AHB, CRC.                  */
+        afio   = 0x100,     /**< APB2, alternate functions. */
+        gpio_a = 0x102,     /**< APB2, port A.              */
+        gpio_b = 0x103,     /**< APB2, port B.              */
+        gpio_c = 0x104,     /**< APB2, port C.              */
+        gpio_d = 0x105,     /**< APB2, port D.              */
+        gpio_e = 0x106,     /**< APB2, port E.              */
+        adc1   = 0x109,     /**< APB2, ADC1.                */
+        adc2   = 0x10A,     /**< APB2, ADC2.                */
+        tim1   = 0x10B,     /**< APB2, TIM1.                */
+        spi1   = 0x10C,     /**< APB2, SPI1.                */
+        usart1 = 0x10E,     /**< APB2, USART1.              */
+        tim2   = 0x200,     /**< APB1, TIM2.                */
+        tim3   = 0x201,     /**< APB1, TIM3.                */
+        tim4   = 0x202,     /**< APB1, TIM4.                */
+        wwdg   = 0x20B,     /**< APB1, window watchdog.     */
+        spi2   = 0x20E,     /**< APB1, SPI2.                */
+        usart2 = 0x211,     /**< APB1, USART2.              */
+        usart3 = 0x212,     /**< APB1, USART3.              */
+        i2c1   = 0x215,     /**< APB1, I2C1.                */
+        i2c2   = 0x216,     /**< APB1, I2C2.                */
+        usb    = 0x217,     /**< APB1, USB.                 */
+        can    = 0x219,     /**< APB1, CAN.                 */
+        bkp    = 0x21B,     /**< APB1, backup interface.    */
+        pwr    = 0x21C      /**< APB1, power interface.     */
+    };
+
+    /**
+     *  Clock control register layout.
+     */
+    struct Cr {
+        using hsion   = Field<Cr,  0, 1, Access_policy::read_write, bool>;  /**< HSI enable.          */
+        using hsirdy  = Field<Cr,  1, 1, Access_policy::read_only,  bool>;  /**< HSI ready.           */
+        using hsitrim = Field<Cr,  3, 5>;                                   /**< HSI trimming.        */
+        using hsical  = Field<Cr,  8, 8, Access_policy::read_only>;         /**< HSI calibration.     */
+        using hseon   = Field<Cr, 16, 1, Access_policy::read_write, bool>;  /**< HSE enable.          */
+        using hserdy  = Field<Cr, 17, 1, Access_policy::read_only,  bool>;  /**< HSE ready.           */
+        using hsebyp  = Field<Cr, 18, 1, Access_policy::read_write, bool>;  /**< HSE bypass.          */
+        using csson   = Field<Cr, 19, 1, Access_policy::read_write, bool>;  /**< Clock security.      */
+        using pllon   = Field<Cr, 24, 1, Access_policy::read_write, bool>;  /**< PLL enable.          */
+        using pllrdy  = Field<Cr, 25, 1, Access_policy::read_only,  bool>;  /**< PLL ready.           */
+    };
+
+    /**
+     *  Clock configuration register layout.
+     */
+    struct Cfgr {
+        using sw       = Field<Cfgr,  0, 2, Access_policy::read_write, Sysclk_source>; /**< System clock switch.     */
+        using sws      = Field<Cfgr,  2, 2, Access_policy::read_only,  Sysclk_source>; /**< System clock status.     */
+        using hpre     = Field<Cfgr,  4, 4>;                                           /**< AHB prescaler.           */
+        using ppre1    = Field<Cfgr,  8, 3>;                                           /**< APB1 prescaler.          */
+        using ppre2    = Field<Cfgr, 11, 3>;                                           /**< APB2 prescaler.          */
+        using adcpre   = Field<Cfgr, 14, 2>;                                           /**< ADC prescaler.           */
+        using pllsrc   = Field<Cfgr, 16, 1, Access_policy::read_write, Pll_source>;    /**< PLL entry clock source.  */
+        using pllxtpre = Field<Cfgr, 17, 1, Access_policy::read_write, bool>;          /**< HSE divider for PLL.     */
+        using pllmul   = Field<Cfgr, 18, 4>;                                           /**< PLL multiplication.      */
+        using usbpre   = Field<Cfgr, 22, 1, Access_policy::read_write, bool>;          /**< USB prescaler.           */
+        using mco      = Field<Cfgr, 24, 3>;                                           /**< Microcontroller output.  */
+    };
+
     constexpr Rcc();
 
-    void set_clock(const uint32_t& hz) const;
+    /**
+     *  Sets the system clock, with HCLK and PCLK2 equal to it and PCLK1 at
+     *  the fastest clock within its limit.
+     *  @param[in]  hz  System clock in Hertz.
+     *  @return         True when the clock could be derived and was applied.
+     */
+    bool set_clock(const uint32_t& hz) const;
+
+    /**
+     *  Sets the clock tree, rejecting impossible configurations at compile time.
+     *  @tparam Sysclk  System clock in Hertz.
+     *  @tparam Hclk    AHB clock in Hertz.
+     *  @tparam Pclk1   APB1 clock in Hertz.
+     *  @tparam Pclk2   APB2 clock in Hertz.
+     *  @return None.
+     */
+    template<uint32_t Sysclk,
+             uint32_t Hclk  = Sysclk,
+             uint32_t Pclk1 = ((Hclk > Clock_limits::pclk1_max) ? (Hclk / 2UL) : Hclk),
+             uint32_t Pclk2 = Hclk>
+    void set_clock() const;
+
+    /**
+     *  Applies a solved clock configuration.
+     *  @param[in]  config  Valid clock configuration.
+     *  @return None.
+     */
+    void set_clock(const Clock_config& config) const;
+
+    /**
+     *  Returns the clock configuration currently applied.
+     *  @return Reference to the clock configuration.
+     */
+    const Clock_config& get_clock() const;
+
     void enable_gpio(const uint8_t& port_nr) const;
     void disable_gpio(const uint8_t& port_nr) const;
 
+    /**
+     *  Enables the clock of a peripheral.
+     *  @param[in]  peripheral  Peripheral.
+     *  @return None.
+     */
+    void enable(const Peripheral& peripheral) const;
+
+    /**
+     *  Disables the clock of a peripheral.
+     *  @param[in]  peripheral  Peripheral.
+     *  @return None.
+     */
+    void disable(const Peripheral& peripheral) const;
+
+    /**
+     *  Checks whether the clock of a peripheral is enabled.
+     *  @param[in]  peripheral  Peripheral.
+     *  @return                 True when enabled.
+     */
+    bool is_enabled(const Peripheral& peripheral) const;
+
 private:
 
-    Memory_register<Access_policy::read_write> cr;
-    Memory_register<Access_policy::read_write> cfgr;
+    /**
+     *  Enable bit of a peripheral in AHBENR, APB2ENR or APB1ENR.
+     *  @param[in]  peripheral  Peripheral.
+     *  @return                 Enable bit.
+     */
+    Memory_bit<Access_policy::read_write> enable_bit(const Peripheral& peripheral) const;
+
+    Field_register<Cr>                         cr;
+    Field_register<Cfgr>                       cfgr;
     Memory_register<Access_policy::read_write> cir;
     Memory_register<Access_policy::read_write> apb2rstr;
     Memory_register<Access_policy::read_write> apb1rstr;
@@ -64,6 +211,11 @@ constexpr Rcc::Rcc() :
 
 }
 
+template<uint32_t Sysclk, uint32_t Hclk, uint32_t Pclk1, uint32_t Pclk2>
+void Rcc::set_clock() const {
+    set_clock(Clock_tree<Sysclk, Hclk, Pclk1, Pclk2>::config);
+}
+
 } /* namespace stm32f10xx */
 
 constexpr stm32f10xxx::Rcc rcc;
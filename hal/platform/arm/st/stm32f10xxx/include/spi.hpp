@@ -0,0 +1,286 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    spi.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Serial peripheral interface master.
+ */
+
+#ifndef BMPP_HAL_STM32F10XXX_SPI_HPP__
+#define BMPP_HAL_STM32F10XXX_SPI_HPP__
+
+/* System. */
+#include <array>            /* Buffers.             */
+#include <cstdint>          /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "mem_access.hpp"       /* Mapped memory access. */
+#include "register_field.hpp"   /* Register bitfields.   */
+#include "rcc.hpp"              /* Peripheral clocks.    */
+#include "dma.hpp"              /* Data transfers.       */
+#include "gpio.hpp"             /* Chip selects.         */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  SPI master moving all frames by DMA. Transfers are queued as
+ *  transactions and started back to back from the DMA interrupt of the
+ *  previous one, so the CPU only steps in between transactions, never per
+ *  frame.
+ *
+ *  A transaction selects its device by driving chip select pins low for
+ *  its duration. It ends with the last received frame, whose clock edges
+ *  are done by then, so the interrupt never waits for the bus. Without a
+ *  receive buffer the received frames are drained into a single element.
+ *  To only receive, pass the receive buffer as transmit buffer too, its
+ *  former content is sent.
+ *
+ *  SCK and MOSI must be configured as alternate_pushpull, MISO as an
+ *  input and chip selects as output_pushpull, high.
+ */
+class Spi {
+public:
+
+    /**
+     *  Clock polarity and phase.
+     */
+    enum class Mode : uint8_t {
+        mode0 = 0,      /**< Idle low, sample on rising edges.  */
+        mode1 = 1,      /**< Idle low, sample on falling edges. */
+        mode2 = 2,      /**< Idle high, sample on falling edges.*/
+        mode3 = 3       /**< Idle high, sample on rising edges. */
+    };
+
+    /**
+     *  Frame size.
+     */
+    enum class Frame : uint8_t {
+        bits8,          /**< Buffers of uint8_t.    */
+        bits16          /**< Buffers of uint16_t.   */
+    };
+
+    /**
+     *  Status register layout.
+     */
+    struct Sr {
+        using rxne = Field<Sr, 0, 1, Access_policy::read_only, bool>;  /**< Data received.         */
+        using txe  = Field<Sr, 1, 1, Access_policy::read_only, bool>;  /**< Data register empty.   */
+        using ovr  = Field<Sr, 6, 1, Access_policy::read_only, bool>;  /**< Overrun.               */
+        using bsy  = Field<Sr, 7, 1, Access_policy::read_only, bool>;  /**< Bus busy.              */
+    };
+
+    /**
+     *  Control register 1 layout.
+     */
+    struct Cr1 {
+        using cpha     = Field<Cr1,  0, 1, Access_policy::read_write, bool>;    /**< Clock phase.       */
+        using cpol     = Field<Cr1,  1, 1, Access_policy::read_write, bool>;    /**< Clock polarity.    */
+        using mstr     = Field<Cr1,  2, 1, Access_policy::read_write, bool>;    /**< Master.            */
+        using br       = Field<Cr1,  3, 3, Access_policy::read_write>;          /**< Clock divider.     */
+        using spe      = Field<Cr1,  6, 1, Access_policy::read_write, bool>;    /**< SPI enable.        */
+        using lsbfirst = Field<Cr1,  7, 1, Access_policy::read_write, bool>;    /**< LSB first.         */
+        using ssi      = Field<Cr1,  8, 1, Access_policy::read_write, bool>;    /**< Internal select.   */
+        using ssm      = Field<Cr1,  9, 1, Access_policy::read_write, bool>;    /**< Software select.   */
+        using dff      = Field<Cr1, 11, 1, Access_policy::read_write, bool>;    /**< 16 bit frames.     */
+    };
+
+    /**
+     *  Control register 2 layout.
+     */
+    struct Cr2 {
+        using rxdmaen = Field<Cr2, 0, 1, Access_policy::read_write, bool>;     /**< DMA receive.       */
+        using txdmaen = Field<Cr2, 1, 1, Access_policy::read_write, bool>;     /**< DMA transmit.      */
+    };
+
+    struct Transaction;
+
+    /**
+     *  Called from interrupt context when a transaction ended.
+     */
+    using Done = void (*)(Transaction& transaction);
+
+    /**
+     *  Transfer of frames to and from one device. Owned by the driver, with
+     *  its buffers, from submit() until pending is false.
+     */
+    struct Transaction {
+        const void*   tx;           /**< Frames to send.                    */
+        void*         rx;           /**< Frames received, or nullptr.       */
+        uint16_t      count;        /**< Number of frames.                  */
+        const Gpio*   cs_port;      /**< Chip select port, or nullptr.      */
+        uint16_t      cs_pins;      /**< Chip select pins, active low.      */
+        Done          done;         /**< Called at the end, or nullptr.     */
+        volatile bool pending;      /**< Queued or in progress.             */
+        Transaction*  next;         /**< Next in the queue.                 */
+    };
+
+    /**
+     *  @param[in]  index       Index of the port, 0 for SPI1.
+     *  @param[in]  address     Base address of the port.
+     *  @param[in]  peripheral  Clock enable of the port.
+     *  @param[in]  rx_dma      DMA channel of received data.
+     *  @param[in]  tx_dma      DMA channel of transmitted data.
+     */
+    constexpr Spi(const uint8_t& index, const uint32_t& address, const Rcc::Peripheral& peripheral,
+                  const Dma_channel& rx_dma, const Dma_channel& tx_dma);
+
+    /**
+     *  Enables the port as master, with the fastest clock not above the
+     *  requested one.
+     *  @param[in]  hz          Maximum clock rate.
+     *  @param[in]  mode        Clock polarity and phase.
+     *  @param[in]  frame       Frame size.
+     *  @param[in]  lsb_first   Send the least significant bit first.
+     *  @return                 False when the rate can not be reached.
+     */
+    bool initialize(const uint32_t& hz, const Mode& mode = Mode::mode0, const Frame& frame = Frame::bits8,
+                    const bool& lsb_first = false) const;
+
+    /**
+     *  Clock of the port, PCLK2 for SPI1 and PCLK1 otherwise.
+     *  @return Clock in Hertz.
+     */
+    uint32_t get_clock() const;
+
+    /**
+     *  Rate of the serial clock.
+     *  @return Clock in Hertz.
+     */
+    uint32_t get_rate() const;
+
+    /**
+     *  Queues a transaction, starting it when the bus is free.
+     *  @param[in]  transaction Transaction, owned until completed.
+     *  @return                 False when still pending or empty.
+     */
+    bool submit(Transaction& transaction) const;
+
+    /**
+     *  Runs a transaction and waits for its end.
+     *  @param[in]  tx      Frames to send.
+     *  @param[out] rx      Frames received, or nullptr.
+     *  @param[in]  count   Number of frames.
+     *  @param[in]  cs_port Chip select port, or nullptr.
+     *  @param[in]  cs_pins Chip select pins.
+     *  @return             False when the transaction could not be queued, or
+     *                      the element size of the arrays does not match
+     *                      the frame size.
+     */
+    bool transfer(const void* tx, void* rx, const uint16_t& count,
+                  const Gpio* cs_port = nullptr, const uint16_t& cs_pins = 0U) const;
+
+    template<class T, std::size_t N>
+    bool transfer(const std::array<T, N>& tx, std::array<T, N>& rx,
+                  const Gpio* cs_port = nullptr, const uint16_t& cs_pins = 0U) const;
+
+    /**
+     *  Checks whether transactions are queued or in progress.
+     *  @return True while busy.
+     */
+    bool is_busy() const;
+
+    /**
+     *  Waits until all queued transactions ended.
+     *  @return None.
+     */
+    void wait() const;
+
+    /**
+     *  Ends a transaction, starting the next one.
+     *  @return None.
+     */
+    void handle_completion() const;
+
+private:
+
+    /**
+     *  Starts the DMA transfers of a transaction.
+     *  @param[in]  transaction Transaction at the head of the queue.
+     *  @return None.
+     */
+    void start(Transaction& transaction) const;
+
+    const uint8_t         index;        /**< Index of the port.         */
+    const Rcc::Peripheral peripheral;   /**< Clock enable of the port.  */
+    const Dma_channel&    rx_dma;       /**< DMA channel of receiving.  */
+    const Dma_channel&    tx_dma;       /**< DMA channel of sending.    */
+
+    /**
+     *  Control register 1.
+     *  Address offset: 0x00
+     *  Reset value:    0x0000'0000
+     */
+    Field_register<Cr1> cr1;
+
+    /**
+     *  Control register 2.
+     *  Address offset: 0x04
+     *  Reset value:    0x0000'0000
+     */
+    Field_register<Cr2> cr2;
+
+    /**
+     *  Status register.
+     *  Address offset: 0x08
+     *  Reset value:    0x0000'0002
+     */
+    Field_register<Sr, Access_policy::read_only> sr;
+
+    /**
+     *  Data register.
+     *  Address offset: 0x0C
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> dr;
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+constexpr Spi::Spi(const uint8_t& index, const uint32_t& address, const Rcc::Peripheral& peripheral,
+                   const Dma_channel& rx_dma, const Dma_channel& tx_dma) :
+    index       (index),
+    peripheral  (peripheral),
+    rx_dma      (rx_dma),
+    tx_dma      (tx_dma),
+    cr1         (address + 0x00UL),
+    cr2         (address + 0x04UL),
+    sr          (address + 0x08UL),
+    dr          (address + 0x0CUL) {
+
+}
+
+template<class T, std::size_t N>
+bool Spi::transfer(const std::array<T, N>& tx, std::array<T, N>& rx, const Gpio* cs_port, const uint16_t& cs_pins) const {
+    static_assert(N <= 0xFFFFUL, "Buffer exceeds a DMA transfer.");
+    static_assert((sizeof(T) == 1U) || (sizeof(T) == 2U), "Frames are 8 or 16 bits.");
+    if(cr1.read<Cr1::dff>() != (sizeof(T) == 2U)) {
+        return false;
+    }
+    return transfer(tx.data(), rx.data(), static_cast<uint16_t>(N), cs_port, cs_pins);
+}
+
+} /* namespace stm32f10xxx */
+
+constexpr stm32f10xxx::Spi spi1(0U, 0x4001'3000UL, stm32f10xxx::Rcc::Peripheral::spi1, dma1_channel2, dma1_channel3);
+constexpr stm32f10xxx::Spi spi2(1U, 0x4000'3800UL, stm32f10xxx::Rcc::Peripheral::spi2, dma1_channel4, dma1_channel5);
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_STM32F10XXX_SPI_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -1,6 +1,8 @@
 #ifndef BMPP_HAL_STM32F10XXX_STARTUP_HPP__
 #define BMPP_HAL_STM32F10XXX_STARTUP_HPP__
 
+#include <cstdint>
+
 extern "C" {
 
 [[gnu::interrupt("IRQ")]]
@@ -8,4 +10,36 @@ void reset_handler();
 
 }
 
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  Cycles spent in reset_handler initializing memory, measured with the
+ *  DWT cycle counter. The counter keeps running afterwards.
+ *  @return Cycles from reset until main was entered.
+ */
+uint32_t get_boot_cycles();
+
+/**
+ *  Whether the last reset kept the .preserved section, i.e. it was not a
+ *  power cycle and the section was valid.
+ *  @return True on a warm start.
+ */
+bool is_warm_start();
+
+/**
+ *  Reset flags of RCC_CSR captured at reset, after which they are removed.
+ *  @return Reset flags, bits 26 to 31.
+ */
+uint32_t get_reset_flags();
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
 #endif /* BMPP_HAL_STM32F10XXX_STARTUP_HPP__ */
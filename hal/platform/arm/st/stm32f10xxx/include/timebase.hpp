@@ -0,0 +1,139 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    timebase.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Monotonic time base and delays.
+ */
+
+#ifndef BMPP_HAL_STM32F10XXX_TIMEBASE_HPP__
+#define BMPP_HAL_STM32F10XXX_TIMEBASE_HPP__
+
+/* System. */
+#include <cstdint>          /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  Monotonic clock counting SysTick periods, with microseconds derived
+ *  from the SysTick counter, and delays calibrated to the clock set by
+ *  Rcc. Long waits are counted in ticks, short waits in processor cycles
+ *  of the DWT cycle counter, so neither depends on flash wait states.
+ *  The time base owns systick_handler.
+ */
+class Timebase {
+public:
+
+    constexpr Timebase();
+
+    /**
+     *  Starts the time base for the current clock configuration. Call again
+     *  after changing the clock.
+     *  @param[in]  tick_hz     Ticks per second, dividing HCLK into periods
+     *                          of at most 2^24 cycles.
+     *  @return                 False, leaving the time base alone, when
+     *                          the rate does not fit.
+     */
+    bool start(const uint32_t& tick_hz = 1000UL) const;
+
+    /**
+     *  Ticks since start, wrapping at 32 bits.
+     *  @return Ticks.
+     */
+    uint32_t get_ticks() const;
+
+    /**
+     *  Ticks since start, without wrapping.
+     *  @return Ticks.
+     */
+    uint64_t get_ticks64() const;
+
+    /**
+     *  Microseconds since start, including the part of the current tick.
+     *  Monotonic also while the SysTick exception is masked, for less than
+     *  a tick.
+     *  @return Microseconds.
+     */
+    uint64_t get_micros() const;
+
+    /**
+     *  Milliseconds since start.
+     *  @return Milliseconds.
+     */
+    uint64_t get_millis() const;
+
+    /**
+     *  Tick at which a duration from now ends.
+     *  @param[in]  ms  Duration in milliseconds.
+     *  @return         Deadline in ticks.
+     */
+    uint32_t deadline(const uint32_t& ms) const;
+
+    /**
+     *  Checks whether a deadline has passed, correct across wrapping for
+     *  durations below 2^31 ticks.
+     *  @param[in]  deadline    Deadline in ticks.
+     *  @return                 True once passed.
+     */
+    bool is_expired(const uint32_t& deadline) const;
+
+    /**
+     *  Waits a number of milliseconds, sleeping between ticks.
+     *  @param[in]  ms  Duration in milliseconds.
+     *  @return None.
+     */
+    void delay(const uint32_t& ms) const;
+
+    /**
+     *  Busy waits a number of microseconds on the cycle counter.
+     *  @param[in]  us  Duration in microseconds.
+     *  @return None.
+     */
+    void delay_us(const uint32_t& us) const;
+
+    /**
+     *  Busy waits a number of processor cycles on the cycle counter.
+     *  @param[in]  cycles  Duration in cycles.
+     *  @return None.
+     */
+    void delay_cycles(const uint32_t& cycles) const;
+
+    /**
+     *  Processor cycles per microsecond at the clock of the last start.
+     *  @return Cycles per microsecond.
+     */
+    uint32_t get_cycles_per_us() const;
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+constexpr Timebase::Timebase() {
+
+}
+
+} /* namespace stm32f10xxx */
+
+constexpr stm32f10xxx::Timebase timebase;
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_STM32F10XXX_TIMEBASE_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
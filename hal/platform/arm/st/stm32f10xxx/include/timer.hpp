@@ -0,0 +1,219 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    timer.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Timer time base and update events.
+ */
+
+#ifndef BMPP_HAL_STM32F10XXX_TIMER_HPP__
+#define BMPP_HAL_STM32F10XXX_TIMER_HPP__
+
+/* System. */
+#include <cstdint>          /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "mem_access.hpp"       /* Mapped memory access. */
+#include "register_field.hpp"   /* Register bitfields.   */
+#include "rcc.hpp"              /* Peripheral clocks.    */
+#include "dma.hpp"              /* Update DMA requests.  */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  Time base of an advanced or general purpose timer, counting up and
+ *  pacing DMA transfers with its update events. Every update event
+ *  requests the DMA channel wired to the timer.
+ */
+class Timer {
+public:
+
+    /**
+     *  Control register 1 layout.
+     */
+    struct Cr1 {
+        using cen  = Field<Cr1, 0, 1, Access_policy::read_write, bool>;    /**< Counter enable.            */
+        using udis = Field<Cr1, 1, 1, Access_policy::read_write, bool>;    /**< Update disable.            */
+        using urs  = Field<Cr1, 2, 1, Access_policy::read_write, bool>;    /**< Update on overflow only.   */
+        using opm  = Field<Cr1, 3, 1, Access_policy::read_write, bool>;    /**< One pulse mode.            */
+        using dir  = Field<Cr1, 4, 1, Access_policy::read_write, bool>;    /**< Count down.                */
+        using arpe = Field<Cr1, 7, 1, Access_policy::read_write, bool>;    /**< Buffered reload.           */
+    };
+
+    /**
+     *  DMA/interrupt enable register layout.
+     */
+    struct Dier {
+        using uie = Field<Dier, 0, 1, Access_policy::read_write, bool>;    /**< Update interrupt.          */
+        using ude = Field<Dier, 8, 1, Access_policy::read_write, bool>;    /**< Update DMA request.        */
+    };
+
+    /**
+     *  @param[in]  address     Base address of the timer.
+     *  @param[in]  peripheral  Clock enable of the timer.
+     *  @param[in]  update_dma  DMA channel requested by update events.
+     */
+    constexpr Timer(const uint32_t& address, const Rcc::Peripheral& peripheral, const Dma_channel& update_dma);
+
+    /**
+     *  Enables the clock of the timer.
+     *  @return None.
+     */
+    void initialize() const;
+
+    /**
+     *  Counter clock before the prescaler, twice the APB clock when the APB
+     *  is divided.
+     *  @return Clock in Hertz.
+     */
+    uint32_t get_clock() const;
+
+    /**
+     *  Sets the rate of update events, choosing the smallest prescaler for
+     *  the finest resolution.
+     *  @param[in]  hz  Update events per second.
+     *  @return         False when the rate can not be reached, i.e. above
+     *                  half the timer clock.
+     */
+    bool set_rate(const uint32_t& hz) const;
+
+    /**
+     *  Sets the prescaler and reload value directly.
+     *  @param[in]  prescaler   Clock division minus one.
+     *  @param[in]  reload      Counts per update minus one.
+     *  @return None.
+     */
+    void set_period(const uint16_t& prescaler, const uint16_t& reload) const;
+
+    /**
+     *  Rate of update events.
+     *  @return Update events per second.
+     */
+    uint32_t get_rate() const;
+
+    /**
+     *  Starts counting from zero.
+     *  @return None.
+     */
+    void start() const;
+
+    /**
+     *  Stops counting.
+     *  @return None.
+     */
+    void stop() const;
+
+    /**
+     *  Enables or disables DMA requests on update events.
+     *  @param[in]  enable  True to request the update DMA channel.
+     *  @return None.
+     */
+    void set_update_dma(const bool& enable) const;
+
+    /**
+     *  DMA channel requested by update events.
+     *  @return Reference to the channel.
+     */
+    constexpr const Dma_channel& get_update_dma() const;
+
+private:
+
+    const Rcc::Peripheral peripheral;   /**< Clock enable of the timer.     */
+    const Dma_channel&    update_dma;   /**< Channel of update requests.    */
+
+    /**
+     *  Control register 1.
+     *  Address offset: 0x00
+     *  Reset value:    0x0000'0000
+     */
+    Field_register<Cr1> cr1;
+
+    /**
+     *  DMA/interrupt enable register.
+     *  Address offset: 0x0C
+     *  Reset value:    0x0000'0000
+     */
+    Field_register<Dier> dier;
+
+    /**
+     *  Status register.
+     *  Address offset: 0x10
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> sr;
+
+    /**
+     *  Event generation register.
+     *  Address offset: 0x14
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::write_only> egr;
+
+    /**
+     *  Counter.
+     *  Address offset: 0x24
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> cnt;
+
+    /**
+     *  Prescaler.
+     *  Address offset: 0x28
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> psc;
+
+    /**
+     *  Auto-reload register.
+     *  Address offset: 0x2C
+     *  Reset value:    0x0000'FFFF
+     */
+    Memory_register<Access_policy::read_write> arr;
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+constexpr Timer::Timer(const uint32_t& address, const Rcc::Peripheral& peripheral, const Dma_channel& update_dma) :
+    peripheral  (peripheral),
+    update_dma  (update_dma),
+    cr1         (address + 0x00UL),
+    dier        (address + 0x0CUL),
+    sr          (address + 0x10UL),
+    egr         (address + 0x14UL),
+    cnt         (address + 0x24UL),
+    psc         (address + 0x28UL),
+    arr         (address + 0x2CUL) {
+
+}
+
+constexpr const Dma_channel& Timer::get_update_dma() const {
+    return update_dma;
+}
+
+} /* namespace stm32f10xxx */
+
+constexpr stm32f10xxx::Timer tim1(0x4001'2C00UL, stm32f10xxx::Rcc::Peripheral::tim1, dma1_channel5);
+constexpr stm32f10xxx::Timer tim2(0x4000'0000UL, stm32f10xxx::Rcc::Peripheral::tim2, dma1_channel2);
+constexpr stm32f10xxx::Timer tim3(0x4000'0400UL, stm32f10xxx::Rcc::Peripheral::tim3, dma1_channel3);
+constexpr stm32f10xxx::Timer tim4(0x4000'0800UL, stm32f10xxx::Rcc::Peripheral::tim4, dma1_channel7);
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_STM32F10XXX_TIMER_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
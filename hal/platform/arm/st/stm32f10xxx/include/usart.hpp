@@ -0,0 +1,333 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    usart.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Universal synchronous/asynchronous receiver/transmitter.
+ */
+
+#ifndef BMPP_HAL_STM32F10XXX_USART_HPP__
+#define BMPP_HAL_STM32F10XXX_USART_HPP__
+
+/* System. */
+#include <array>            /* Buffers.             */
+#include <cstdint>          /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "mem_access.hpp"       /* Mapped memory access. */
+#include "register_field.hpp"   /* Register bitfields.   */
+#include "rcc.hpp"              /* Peripheral clocks.    */
+#include "dma.hpp"              /* Data transfers.       */
+#include "irq.hpp"              /* Interrupt numbers.    */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  Asynchronous serial port moving all data by DMA, without an interrupt
+ *  per byte. Received bytes stream circularly into a ring buffer, from
+ *  which read() takes them without waiting. An idle line after a burst
+ *  of data, and every half of the ring, notify the receiver, so frames
+ *  are handled as soon as the sender pauses. Transmissions are sent
+ *  directly from the buffer of the caller, which must stay unchanged
+ *  until is_writing() returns false.
+ *
+ *  TX must be configured as alternate_pushpull, RX as an input. The
+ *  driver owns usart1_handler to usart3_handler.
+ */
+class Usart {
+public:
+
+    static const uint32_t tolerance_ppm = 10'000UL;    /**< Allowed baud rate error.   */
+
+    /**
+     *  Status register layout.
+     */
+    struct Sr {
+        using pe   = Field<Sr, 0, 1, Access_policy::read_only, bool>;  /**< Parity error.          */
+        using fe   = Field<Sr, 1, 1, Access_policy::read_only, bool>;  /**< Framing error.         */
+        using ne   = Field<Sr, 2, 1, Access_policy::read_only, bool>;  /**< Noise detected.        */
+        using ore  = Field<Sr, 3, 1, Access_policy::read_only, bool>;  /**< Overrun error.         */
+        using idle = Field<Sr, 4, 1, Access_policy::read_only, bool>;  /**< Idle line detected.    */
+        using rxne = Field<Sr, 5, 1, Access_policy::read_only, bool>;  /**< Data received.         */
+        using tc   = Field<Sr, 6, 1, Access_policy::read_write, bool>; /**< Transmission complete. */
+        using txe  = Field<Sr, 7, 1, Access_policy::read_only, bool>;  /**< Data register empty.   */
+    };
+
+    /**
+     *  Control register 1 layout.
+     */
+    struct Cr1 {
+        using re     = Field<Cr1,  2, 1, Access_policy::read_write, bool>;  /**< Receiver enable.       */
+        using te     = Field<Cr1,  3, 1, Access_policy::read_write, bool>;  /**< Transmitter enable.    */
+        using idleie = Field<Cr1,  4, 1, Access_policy::read_write, bool>;  /**< Idle interrupt.        */
+        using ps     = Field<Cr1,  9, 1, Access_policy::read_write, bool>;  /**< Odd parity.            */
+        using pce    = Field<Cr1, 10, 1, Access_policy::read_write, bool>;  /**< Parity control.        */
+        using m      = Field<Cr1, 12, 1, Access_policy::read_write, bool>;  /**< Nine data bits.        */
+        using ue     = Field<Cr1, 13, 1, Access_policy::read_write, bool>;  /**< USART enable.          */
+    };
+
+    /**
+     *  Control register 3 layout.
+     */
+    struct Cr3 {
+        using dmar = Field<Cr3, 6, 1, Access_policy::read_write, bool>;    /**< DMA receive.           */
+        using dmat = Field<Cr3, 7, 1, Access_policy::read_write, bool>;    /**< DMA transmit.          */
+    };
+
+    /**
+     *  Called from interrupt context.
+     */
+    using Notify = void (*)();
+
+    /**
+     *  @param[in]  index       Index of the port, 0 for USART1.
+     *  @param[in]  address     Base address of the port.
+     *  @param[in]  peripheral  Clock enable of the port.
+     *  @param[in]  rx_dma      DMA channel of received data.
+     *  @param[in]  tx_dma      DMA channel of transmitted data.
+     *  @param[in]  irq         Interrupt of the port.
+     */
+    constexpr Usart(const uint8_t& index, const uint32_t& address, const Rcc::Peripheral& peripheral,
+                    const Dma_channel& rx_dma, const Dma_channel& tx_dma, const Irq& irq);
+
+    /**
+     *  Baud rate register value, rounded to the nearest divider.
+     *  @param[in]  pclk    Clock of the port in Hertz.
+     *  @param[in]  baud    Baud rate.
+     *  @return             BRR value.
+     */
+    static constexpr uint32_t brr(const uint32_t& pclk, const uint32_t& baud);
+
+    /**
+     *  Deviation of the baud rate obtained from the requested one.
+     *  @param[in]  pclk    Clock of the port in Hertz.
+     *  @param[in]  baud    Baud rate.
+     *  @return             Error in parts per million.
+     */
+    static constexpr uint32_t error_ppm(const uint32_t& pclk, const uint32_t& baud);
+
+    /**
+     *  Checks whether a baud rate can be generated from a clock.
+     *  @param[in]  pclk    Clock of the port in Hertz.
+     *  @param[in]  baud    Baud rate.
+     *  @return             True when within tolerance.
+     */
+    static constexpr bool is_valid(const uint32_t& pclk, const uint32_t& baud);
+
+    /**
+     *  Sets a baud rate checked at compile time, e.g. for a clock of
+     *  Clock_tree<...>::config.pclk2.
+     *  @tparam     Baud    Baud rate.
+     *  @tparam     Pclk    Clock of the port in Hertz.
+     *  @return None.
+     */
+    template<uint32_t Baud, uint32_t Pclk>
+    void set_baud() const;
+
+    /**
+     *  Sets a baud rate for the clock currently applied by Rcc.
+     *  @param[in]  baud    Baud rate.
+     *  @return             False when out of tolerance.
+     */
+    bool set_baud(const uint32_t& baud) const;
+
+    /**
+     *  Clock of the port, PCLK2 for USART1 and PCLK1 otherwise.
+     *  @return Clock in Hertz.
+     */
+    uint32_t get_clock() const;
+
+    /**
+     *  Enables the port and starts receiving into a ring buffer. Set the
+     *  baud rate before.
+     *  @param[out] ring    Ring buffer, owned by the port until stopped.
+     *  @param[in]  size    Size of the ring buffer.
+     *  @param[in]  receive Called on an idle line and per half ring, may be
+     *                      nullptr.
+     *  @return None.
+     */
+    void start(uint8_t* ring, const uint16_t& size, Notify receive = nullptr) const;
+
+    template<std::size_t N>
+    void start(std::array<uint8_t, N>& ring, Notify receive = nullptr) const;
+
+    /**
+     *  Disables the port, aborting transfers.
+     *  @return None.
+     */
+    void stop() const;
+
+    /**
+     *  Number of received bytes not yet read. Bytes not read within the
+     *  size of the ring are overwritten.
+     *  @return Bytes available.
+     */
+    uint16_t available() const;
+
+    /**
+     *  Takes received bytes from the ring without waiting.
+     *  @param[out] data    Destination.
+     *  @param[in]  max     Maximum number of bytes.
+     *  @return             Number of bytes read.
+     */
+    uint16_t read(uint8_t* data, const uint16_t& max) const;
+
+    /**
+     *  Starts sending a buffer without copying it.
+     *  @param[in]  data    Bytes, owned by the port until sent.
+     *  @param[in]  count   Number of bytes.
+     *  @param[in]  sent    Called when the DMA is done, may be nullptr.
+     *  @return             False when a transmission is in progress.
+     */
+    bool write(const uint8_t* data, const uint16_t& count, Notify sent = nullptr) const;
+
+    template<std::size_t N>
+    bool write(const std::array<uint8_t, N>& data, Notify sent = nullptr) const;
+
+    /**
+     *  Checks whether the buffer of a transmission is still in use.
+     *  @return True while sending.
+     */
+    bool is_writing() const;
+
+    /**
+     *  Waits until the last byte has left the shift register.
+     *  @return None.
+     */
+    void flush() const;
+
+    /**
+     *  Serves the port interrupt.
+     *  @return None.
+     */
+    void handle_interrupt() const;
+
+private:
+
+    const uint8_t         index;        /**< Index of the port.         */
+    const Rcc::Peripheral peripheral;   /**< Clock enable of the port.  */
+    const Dma_channel&    rx_dma;       /**< DMA channel of receiving.  */
+    const Dma_channel&    tx_dma;       /**< DMA channel of sending.    */
+    const Irq             irq;          /**< Interrupt of the port.     */
+
+    /**
+     *  Status register.
+     *  Address offset: 0x00
+     *  Reset value:    0x0000'00C0
+     */
+    Field_register<Sr> sr;
+
+    /**
+     *  Data register.
+     *  Address offset: 0x04
+     *  Reset value:    0x0000'XXXX
+     */
+    Memory_register<Access_policy::read_write> dr;
+
+    /**
+     *  Baud rate register.
+     *  Address offset: 0x08
+     *  Reset value:    0x0000'0000
+     */
+    Memory_register<Access_policy::read_write> brr_;
+
+    /**
+     *  Control register 1.
+     *  Address offset: 0x0C
+     *  Reset value:    0x0000'0000
+     */
+    Field_register<Cr1> cr1;
+
+    /**
+     *  Control register 3.
+     *  Address offset: 0x14
+     *  Reset value:    0x0000'0000
+     */
+    Field_register<Cr3> cr3;
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+constexpr Usart::Usart(const uint8_t& index, const uint32_t& address, const Rcc::Peripheral& peripheral,
+                       const Dma_channel& rx_dma, const Dma_channel& tx_dma, const Irq& irq) :
+    index       (index),
+    peripheral  (peripheral),
+    rx_dma      (rx_dma),
+    tx_dma      (tx_dma),
+    irq         (irq),
+    sr          (address + 0x00UL),
+    dr          (address + 0x04UL),
+    brr_        (address + 0x08UL),
+    cr1         (address + 0x0CUL),
+    cr3         (address + 0x14UL) {
+
+}
+
+constexpr uint32_t Usart::brr(const uint32_t& pclk, const uint32_t& baud) {
+    /* Mantissa and fraction of pclk / (16 * baud) in sixteenths. */
+    return ((pclk + (baud / 2UL)) / baud);
+}
+
+constexpr uint32_t Usart::error_ppm(const uint32_t& pclk, const uint32_t& baud) {
+    return (brr(pclk, baud) == 0UL) ? 1'000'000UL
+         : static_cast<uint32_t>(((static_cast<uint64_t>(pclk / brr(pclk, baud)) > baud)
+                                  ? ((static_cast<uint64_t>(pclk / brr(pclk, baud)) - baud) * 1'000'000ULL)
+                                  : ((baud - static_cast<uint64_t>(pclk / brr(pclk, baud))) * 1'000'000ULL)) / baud);
+}
+
+constexpr bool Usart::is_valid(const uint32_t& pclk, const uint32_t& baud) {
+    return (baud > 0UL) && (brr(pclk, baud) >= 16UL) && (brr(pclk, baud) <= 0xFFFFUL)
+           && (error_ppm(pclk, baud) <= tolerance_ppm);
+}
+
+template<uint32_t Baud, uint32_t Pclk>
+void Usart::set_baud() const {
+    static_assert(Baud > 0UL, "Baud rate is zero.");
+    static_assert(brr(Pclk, Baud) >= 16UL, "Baud rate exceeds PCLK / 16.");
+    static_assert(brr(Pclk, Baud) <= 0xFFFFUL, "Baud rate too low for PCLK.");
+    static_assert(error_ppm(Pclk, Baud) <= tolerance_ppm, "Baud rate error exceeds tolerance.");
+    brr_ = brr(Pclk, Baud);
+}
+
+template<std::size_t N>
+void Usart::start(std::array<uint8_t, N>& ring, Notify receive) const {
+    static_assert(N <= 0xFFFFUL, "Buffer exceeds a DMA transfer.");
+    static_assert((N % 2UL) == 0UL, "Ring must have an even size.");
+    start(ring.data(), static_cast<uint16_t>(N), receive);
+}
+
+template<std::size_t N>
+bool Usart::write(const std::array<uint8_t, N>& data, Notify sent) const {
+    static_assert(N <= 0xFFFFUL, "Buffer exceeds a DMA transfer.");
+    return write(data.data(), static_cast<uint16_t>(N), sent);
+}
+
+} /* namespace stm32f10xxx */
+
+constexpr stm32f10xxx::Usart usart1(0U, 0x4001'3800UL, stm32f10xxx::Rcc::Peripheral::usart1,
+                                    dma1_channel5, dma1_channel4, stm32f10xxx::Irq::usart1);
+constexpr stm32f10xxx::Usart usart2(1U, 0x4000'4400UL, stm32f10xxx::Rcc::Peripheral::usart2,
+                                    dma1_channel6, dma1_channel7, stm32f10xxx::Irq::usart2);
+constexpr stm32f10xxx::Usart usart3(2U, 0x4000'4800UL, stm32f10xxx::Rcc::Peripheral::usart3,
+                                    dma1_channel3, dma1_channel2, stm32f10xxx::Irq::usart3);
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_STM32F10XXX_USART_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,91 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    vector_table.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Vector table relocated to RAM with runtime handler registration.
+ */
+
+#ifndef BMPP_HAL_STM32F10XXX_VECTOR_TABLE_HPP__
+#define BMPP_HAL_STM32F10XXX_VECTOR_TABLE_HPP__
+
+/* System. */
+#include <cstdint>          /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "irq.hpp"          /* Interrupt numbers.   */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+using Handler = void (*)();     /**< Interrupt handler. */
+
+/**
+ *  Copies the vector table from flash to RAM and points VTOR at the copy,
+ *  so handlers can be installed at runtime. Called by reset_handler when
+ *  built with RAM_VECTORS.
+ *
+ *  This is not faster: a vector in flash is fetched over the I-Code bus
+ *  while the exception frame is stacked over the System bus, a vector in
+ *  SRAM is fetched over the System bus after stacking, which can add
+ *  cycles to the interrupt entry.
+ *  @return None.
+ */
+void relocate_vector_table();
+
+/**
+ *  Checks whether the vector table in RAM is active.
+ *  @return True when VTOR points at the RAM copy.
+ */
+bool is_vector_table_relocated();
+
+/**
+ *  Installs a handler for a device interrupt, in the RAM vector table.
+ *  The table is relocated first when needed. Installing takes effect with
+ *  the next interrupt entry.
+ *  @param[in]  irq     Interrupt number.
+ *  @param[in]  handler Handler to install.
+ *  @return             Previously installed handler.
+ */
+Handler set_handler(const Irq& irq, const Handler& handler);
+
+/**
+ *  Installs a handler for a system exception, in the RAM vector table.
+ *  @param[in]  exception   System exception.
+ *  @param[in]  handler     Handler to install.
+ *  @return                 Previously installed handler.
+ */
+Handler set_handler(const cortex_m3::Exception& exception, const Handler& handler);
+
+/**
+ *  Handler of a device interrupt in the active vector table.
+ *  @param[in]  irq     Interrupt number.
+ *  @return             Installed handler.
+ */
+Handler get_handler(const Irq& irq);
+
+/**
+ *  Restores the handler of a device interrupt linked into the flash table.
+ *  @param[in]  irq     Interrupt number.
+ *  @return None.
+ */
+void restore_handler(const Irq& irq);
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_STM32F10XXX_VECTOR_TABLE_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
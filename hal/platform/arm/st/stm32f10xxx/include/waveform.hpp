@@ -0,0 +1,161 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    waveform.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Timer paced DMA waveform output on GPIO ports.
+ */
+
+#ifndef BMPP_HAL_STM32F10XXX_WAVEFORM_HPP__
+#define BMPP_HAL_STM32F10XXX_WAVEFORM_HPP__
+
+/* System. */
+#include <array>            /* Buffers.             */
+#include <cstdint>          /* Fixed size integers. */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "gpio.hpp"         /* Output ports.        */
+#include "timer.hpp"        /* Pacing timer.        */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  Plays a buffer of BSRR words into a port, one word per update event of
+ *  a timer, moved by the update DMA channel of the timer. Any pins of the
+ *  port change together on every step, independent of interrupts and CPU
+ *  load. Pins must be configured as outputs and the port clock enabled.
+ *
+ *  A stream plays a buffer circularly, calling a refill function for the
+ *  half which has just been played while the DMA plays the other half.
+ */
+class Waveform {
+public:
+
+    /**
+     *  Called from interrupt context to refill a played half of a stream.
+     */
+    using Refill = void (*)(uint32_t* words, const uint16_t& count);
+
+    /**
+     *  @param[in]  timer   Timer pacing the output.
+     */
+    explicit constexpr Waveform(const Timer& timer);
+
+    /**
+     *  BSRR word of a step, with set taking precedence over clear.
+     *  @param[in]  set_mask    Pins to set high.
+     *  @param[in]  clear_mask  Pins to set low.
+     *  @return                 BSRR word.
+     */
+    static constexpr uint32_t word(const uint32_t& set_mask, const uint32_t& clear_mask);
+
+    /**
+     *  Plays a buffer once.
+     *  @param[in]  port    Output port.
+     *  @param[in]  words   BSRR words, kept unchanged until played.
+     *  @param[in]  count   Number of words.
+     *  @param[in]  hz      Words per second.
+     *  @return             False when the rate can not be reached.
+     */
+    bool play(const Gpio& port, const uint32_t* words, const uint16_t& count, const uint32_t& hz) const;
+
+    template<std::size_t N>
+    bool play(const Gpio& port, const std::array<uint32_t, N>& words, const uint32_t& hz) const;
+
+    /**
+     *  Plays a buffer continuously until stopped.
+     *  @param[in]  port    Output port.
+     *  @param[in]  words   Prefilled BSRR words, of an even count.
+     *  @param[in]  count   Number of words.
+     *  @param[in]  hz      Words per second.
+     *  @param[in]  refill  Refills each played half, may be nullptr to repeat.
+     *  @return             False when the count is zero or odd, or the rate
+     *                      can not be reached.
+     */
+    bool stream(const Gpio& port, uint32_t* words, const uint16_t& count, const uint32_t& hz, Refill refill) const;
+
+    template<std::size_t N>
+    bool stream(const Gpio& port, std::array<uint32_t, N>& words, const uint32_t& hz, Refill refill) const;
+
+    /**
+     *  Checks whether a buffer is playing.
+     *  @return True while playing.
+     */
+    bool is_playing() const;
+
+    /**
+     *  Waits until a single play ends.
+     *  @return None.
+     */
+    void wait() const;
+
+    /**
+     *  Stops playing, leaving the pins in their current state.
+     *  @return None.
+     */
+    void stop() const;
+
+private:
+
+    /**
+     *  Starts the DMA and the timer.
+     *  @param[in]  port    Output port.
+     *  @param[in]  words   BSRR words.
+     *  @param[in]  count   Number of words.
+     *  @param[in]  hz      Words per second.
+     *  @param[in]  refill  Refill of a stream, or nullptr.
+     *  @param[in]  mode    Transfer mode.
+     *  @return             False when the rate can not be reached.
+     */
+    bool start(const Gpio& port, const uint32_t* words, const uint16_t& count, const uint32_t& hz,
+               Refill refill, const Dma_channel::Mode& mode) const;
+
+    const Timer& timer;     /**< Timer pacing the output.   */
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+constexpr Waveform::Waveform(const Timer& timer) :
+    timer   (timer) {
+
+}
+
+constexpr uint32_t Waveform::word(const uint32_t& set_mask, const uint32_t& clear_mask) {
+    return (((clear_mask & 0xFFFFUL) << 16UL) | (set_mask & 0xFFFFUL));
+}
+
+template<std::size_t N>
+bool Waveform::play(const Gpio& port, const std::array<uint32_t, N>& words, const uint32_t& hz) const {
+    static_assert(N <= 0xFFFFUL, "Buffer exceeds a DMA transfer.");
+    return play(port, words.data(), static_cast<uint16_t>(N), hz);
+}
+
+template<std::size_t N>
+bool Waveform::stream(const Gpio& port, std::array<uint32_t, N>& words, const uint32_t& hz, Refill refill) const {
+    static_assert(N <= 0xFFFFUL, "Buffer exceeds a DMA transfer.");
+    static_assert((N % 2UL) == 0UL, "Stream buffer must have an even number of words.");
+    return stream(port, words.data(), static_cast<uint16_t>(N), hz, refill);
+}
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_STM32F10XXX_WAVEFORM_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,218 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    capture.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Timer paced DMA sampling of GPIO ports.
+ */
+
+/* System. */
+#include <array>            /* Sessions.    */
+
+/* Third-party. */
+
+/* Local. */
+#include "capture.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+namespace {
+
+/**
+ *  Capture of a DMA channel. Sample positions are counted since the start,
+ *  so they remain ordered when the buffer wraps.
+ */
+struct Session {
+    const Timer*      timer;        /**< Timer pacing the sampling.         */
+    uint16_t*         samples;      /**< Sample buffer.                     */
+    uint16_t          count;        /**< Samples in the buffer.             */
+    uint16_t          half;         /**< Samples per half of the buffer.    */
+    Capture::Block    block;        /**< Stream callback, or nullptr.       */
+    Capture::Done     done;         /**< End of a triggered capture.        */
+    Capture::Trigger  trigger;      /**< Trigger condition.                 */
+    uint16_t          post;         /**< Samples to follow the trigger.     */
+    bool              matched;      /**< Condition held at the last sample. */
+    uint32_t          filled;       /**< Samples in completed halves.       */
+    uint32_t          trigger_at;   /**< Position of the trigger.           */
+    uint32_t          written;      /**< Samples taken when stopped.        */
+    volatile bool     running;      /**< Sampling in progress.              */
+    volatile bool     triggered;    /**< Trigger condition occurred.        */
+};
+
+std::array<Session, Dma_channel::channel_count> sessions;   /**< Session per channel. */
+
+/**
+ *  Stops the timer and the DMA and records the number of samples taken.
+ *  @param[in]  session     Capture.
+ *  @return None.
+ */
+void finish(Session& session) {
+    const Timer& timer = *session.timer;
+    timer.stop();
+    timer.set_update_dma(false);
+    const uint16_t position = static_cast<uint16_t>((session.count - timer.get_update_dma().stop()) % session.count);
+    const uint16_t filled_position = static_cast<uint16_t>(session.filled % session.count);
+    session.written = session.filled + ((position + session.count - filled_position) % session.count);
+    session.running = false;
+}
+
+/**
+ *  Searches a filled half for the trigger condition.
+ *  @param[in]  session     Capture.
+ *  @param[in]  samples     Filled half.
+ *  @return None.
+ */
+void scan(Session& session, const uint16_t* samples) {
+    const Capture::Trigger& trigger = session.trigger;
+    for(uint16_t i = 0U; i < session.half; i++) {
+        const bool match = ((samples[i] & trigger.mask) == trigger.value);
+        if(match && !(trigger.edge && session.matched)) {
+            session.triggered = true;
+            session.trigger_at = (session.filled + i);
+            return;
+        }
+        session.matched = match;
+    }
+}
+
+/**
+ *  DMA events of a channel, serving streams and triggered captures.
+ *  @param[in]  context Session of the channel.
+ *  @param[in]  event   DMA event.
+ *  @return None.
+ */
+void on_event(void* context, const Dma_channel::Event& event) {
+    Session& session = *static_cast<Session*>(context);
+    /* Half and complete served together may end the capture at the half. */
+    if(!session.running) {
+        return;
+    }
+    if(event == Dma_channel::Event::error) {
+        finish(session);
+        return;
+    }
+    const uint16_t* samples = session.samples + ((event == Dma_channel::Event::half) ? 0U : session.half);
+    if(session.block != nullptr) {
+        session.filled += session.half;
+        session.block(samples, session.half);
+        return;
+    }
+    if(!session.triggered) {
+        scan(session, samples);
+    }
+    session.filled += session.half;
+    if(session.triggered && ((session.filled - session.trigger_at) >= session.post)) {
+        finish(session);
+        if(session.done != nullptr) {
+            session.done();
+        }
+    }
+}
+
+} /* namespace */
+
+bool Capture::stream(const Gpio& port, uint16_t* samples, const uint16_t& count, const uint32_t& hz, Block block) const {
+    if((count == 0U) || ((count % 2U) != 0U)) {
+        return false;
+    }
+    stop();
+    Session& session = sessions[timer.get_update_dma().get_channel_nr() - 1U];
+    session.block = block;
+    return start(port, samples, count, hz);
+}
+
+bool Capture::arm(const Gpio& port, uint16_t* samples, const uint16_t& count, const uint32_t& hz,
+                  const Trigger& trigger, const uint16_t& pre_trigger, Done done) const {
+    if((count == 0U) || ((count % 2U) != 0U)) {
+        return false;
+    }
+    stop();
+    Session& session = sessions[timer.get_update_dma().get_channel_nr() - 1U];
+    session.block = nullptr;
+    session.done = done;
+    session.trigger = trigger;
+    /* Without pins to compare, any sample triggers. */
+    session.trigger.edge = (trigger.edge && (trigger.mask != 0U));
+    session.trigger.value = (trigger.value & trigger.mask);
+    /* Stopping at the first half boundary beyond this keeps the pre-trigger samples. */
+    const uint32_t kept = static_cast<uint32_t>(pre_trigger) + (count / 2U);
+    session.post = (count > kept) ? static_cast<uint16_t>(count - kept) : 0U;
+    /* A condition present when armed is not entered. */
+    session.matched = true;
+    return start(port, samples, count, hz);
+}
+
+bool Capture::is_running() const {
+    return sessions[timer.get_update_dma().get_channel_nr() - 1U].running;
+}
+
+bool Capture::is_triggered() const {
+    return sessions[timer.get_update_dma().get_channel_nr() - 1U].triggered;
+}
+
+void Capture::stop() const {
+    Session& session = sessions[timer.get_update_dma().get_channel_nr() - 1U];
+    if(session.running) {
+        finish(session);
+    }
+}
+
+uint16_t Capture::get_size() const {
+    const Session& session = sessions[timer.get_update_dma().get_channel_nr() - 1U];
+    return (session.written < session.count) ? static_cast<uint16_t>(session.written) : session.count;
+}
+
+uint16_t Capture::get_sample(const uint16_t& index) const {
+    const Session& session = sessions[timer.get_update_dma().get_channel_nr() - 1U];
+    const uint32_t oldest = (session.written < session.count) ? 0UL : (session.written % session.count);
+    return session.samples[(oldest + index) % session.count];
+}
+
+uint16_t Capture::get_trigger_index() const {
+    const Session& session = sessions[timer.get_update_dma().get_channel_nr() - 1U];
+    return static_cast<uint16_t>(session.trigger_at - (session.written - get_size()));
+}
+
+bool Capture::start(const Gpio& port, uint16_t* samples, const uint16_t& count, const uint32_t& hz) const {
+    const Dma_channel& dma = timer.get_update_dma();
+    const std::size_t index = (dma.get_channel_nr() - 1U);
+    Session& session = sessions[index];
+
+    timer.initialize();
+    if(!timer.set_rate(hz)) {
+        return false;
+    }
+
+    session.timer = &timer;
+    session.samples = samples;
+    session.count = count;
+    session.half = static_cast<uint16_t>(count / 2U);
+    session.filled = 0UL;
+    session.written = 0UL;
+    session.trigger_at = 0UL;
+    session.triggered = false;
+    session.running = true;
+
+    dma.set_callback(on_event, &session, true);
+    dma.set_priority(Dma_channel::Priority::very_high);
+    dma.receive(port.get_idr_address(), samples, count, Dma_channel::Mode::circular);
+
+    timer.set_update_dma(true);
+    timer.start();
+    return true;
+}
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,212 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    dma.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Direct memory access controller.
+ */
+
+/* System. */
+#include <array>            /* Channel states.  */
+
+/* Third-party. */
+
+/* Local. */
+#include "dma.hpp"
+#include "rcc.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+namespace {
+
+/**
+ *  Settings applied to every transfer of a channel.
+ */
+struct Channel_state {
+    Dma_channel::Callback callback;     /**< Event callback, or nullptr.    */
+    void*                 context;      /**< Passed to the callback.        */
+    bool                  half;         /**< Report half transfers.         */
+    Dma_channel::Priority priority;     /**< Channel priority.              */
+    volatile bool         error;        /**< Last transfer hit a bus error. */
+};
+
+std::array<Channel_state, Dma_channel::channel_count> states;     /**< State per channel. */
+
+const uint32_t flag_mask  = 0xFUL;      /**< Flags of a channel.        */
+const uint32_t flag_error = 0x8UL;      /**< Transfer error flag.       */
+
+/**
+ *  Orders buffer accesses of the CPU with respect to the DMA.
+ *  @return None.
+ */
+inline void barrier() {
+#if defined(ARM)
+    asm volatile ("dmb" : : : "memory");
+#else
+    asm volatile ("" : : : "memory");
+#endif
+}
+
+} /* namespace */
+
+/**
+ *  DMA1 channel 1 interrupt handler, overriding the weak default.
+ */
+void dma1_channel1_handler() {
+    dma1_channel1.handle_interrupt();
+}
+
+/**
+ *  DMA1 channel 2 interrupt handler, overriding the weak default.
+ */
+void dma1_channel2_handler() {
+    dma1_channel2.handle_interrupt();
+}
+
+/**
+ *  DMA1 channel 3 interrupt handler, overriding the weak default.
+ */
+void dma1_channel3_handler() {
+    dma1_channel3.handle_interrupt();
+}
+
+/**
+ *  DMA1 channel 4 interrupt handler, overriding the weak default.
+ */
+void dma1_channel4_handler() {
+    dma1_channel4.handle_interrupt();
+}
+
+/**
+ *  DMA1 channel 5 interrupt handler, overriding the weak default.
+ */
+void dma1_channel5_handler() {
+    dma1_channel5.handle_interrupt();
+}
+
+/**
+ *  DMA1 channel 6 interrupt handler, overriding the weak default.
+ */
+void dma1_channel6_handler() {
+    dma1_channel6.handle_interrupt();
+}
+
+/**
+ *  DMA1 channel 7 interrupt handler, overriding the weak default.
+ */
+void dma1_channel7_handler() {
+    dma1_channel7.handle_interrupt();
+}
+
+void Dma_channel::set_callback(Callback callback, void* context, const bool& half_transfer) const {
+    states[channel_nr - 1U].callback = callback;
+    states[channel_nr - 1U].context = context;
+    states[channel_nr - 1U].half = half_transfer;
+}
+
+void Dma_channel::set_priority(const Priority& priority) const {
+    states[channel_nr - 1U].priority = priority;
+}
+
+bool Dma_channel::is_busy() const {
+    /* A bus error disables the channel, a normal transfer ends at zero. */
+    return ccr.read<Ccr::en>() && (ccr.read<Ccr::circ>() || (cndtr != 0UL));
+}
+
+bool Dma_channel::has_error() const {
+    /* The interrupt clears the flag, so it records the error first. */
+    return states[channel_nr - 1U].error || (((isr >> shift) & flag_error) != 0UL);
+}
+
+bool Dma_channel::wait() const {
+    while(is_busy()) {
+    }
+    barrier();
+    return !has_error();
+}
+
+uint16_t Dma_channel::stop() const {
+    ccr.modify(Ccr::en::clear());
+    barrier();
+    ifcr = (flag_mask << shift);
+    return get_remaining();
+}
+
+uint16_t Dma_channel::get_remaining() const {
+    return static_cast<uint16_t>(cndtr);
+}
+
+void Dma_channel::handle_interrupt() const {
+    Channel_state& state = states[channel_nr - 1U];
+    const uint32_t flags = ((isr >> shift) & flag_mask);
+    if(flags & flag_error) {
+        state.error = true;
+    }
+    ifcr = (flags << shift);
+    const Callback callback = state.callback;
+    if(callback == nullptr) {
+        return;
+    }
+    barrier();
+    /* Flags are set whether or not their interrupt is enabled, the enables
+       share the positions of the flags. */
+    const uint32_t events = (flags & (ccr & (Ccr::tcie::mask() | Ccr::htie::mask() | Ccr::teie::mask())));
+    if(events & (1UL << static_cast<uint32_t>(Event::error))) {
+        callback(state.context, Event::error);
+    }
+    if(events & (1UL << static_cast<uint32_t>(Event::half))) {
+        callback(state.context, Event::half);
+    }
+    if(events & (1UL << static_cast<uint32_t>(Event::complete))) {
+        callback(state.context, Event::complete);
+    }
+}
+
+uint32_t Dma_channel::bus_address(const volatile void* memory) {
+    return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(memory));
+}
+
+bool Dma_channel::start(const Field_value<Ccr>& config, const uint32_t& peripheral, const uint32_t& memory, const uint16_t& count) const {
+    /* The running transfer keeps its buffer until waited for or stopped. */
+    if(is_busy()) {
+        return false;
+    }
+    rcc.enable(Rcc::Peripheral::dma1);
+
+    /* The channel can only be configured while disabled. */
+    ccr.write(Ccr::en::clear());
+    ifcr = (flag_mask << shift);
+    cpar = peripheral;
+    cmar = memory;
+    cndtr = count;
+
+    Channel_state& state = states[channel_nr - 1U];
+    state.error = false;
+    const bool notify = (state.callback != nullptr);
+    if(notify) {
+        nvic.enable(get_irq());
+    }
+    barrier();
+    ccr.write(config
+              | Ccr::pl::value(state.priority)
+              | Ccr::tcie::value(notify)
+              | Ccr::teie::value(notify)
+              | Ccr::htie::value(notify && state.half)
+              | Ccr::en::set());
+    return true;
+}
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,155 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    exti.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   External interrupt/event controller.
+ */
+
+/* System. */
+#include <array>            /* Callback table.  */
+
+/* Third-party. */
+
+/* Local. */
+#include "exti.hpp"
+#include "rcc.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+namespace {
+
+std::array<Exti::Callback, Exti::line_count> callbacks;     /**< Callback per line. */
+
+constexpr Memory_register<Access_policy::read_write> exti_imr(Exti::base_address + 0x00UL);
+constexpr Memory_register<Access_policy::read_write> exti_pr(Exti::base_address + 0x14UL);
+
+/**
+ *  Clears and serves the pending interrupts among a group of lines.
+ *  @param[in]  lines   Lines served by the interrupt.
+ *  @return None.
+ */
+inline void dispatch(const uint32_t& lines) {
+    uint32_t pending = (exti_pr & exti_imr & lines);
+    /* Clear before calling, so edges during a callback raise again. */
+    exti_pr = pending;
+    while(pending != 0UL) {
+        const uint8_t line = static_cast<uint8_t>(__builtin_ctz(pending));
+        pending &= (pending - 1UL);
+        const Exti::Callback callback = callbacks[line];
+        if(callback != nullptr) {
+            callback(line);
+        }
+    }
+}
+
+} /* namespace */
+
+/**
+ *  EXTI line 0 interrupt handler, overriding the weak default.
+ */
+void exti0_handler() {
+    dispatch(Exti::get_group(0U));
+}
+
+/**
+ *  EXTI line 1 interrupt handler, overriding the weak default.
+ */
+void exti1_handler() {
+    dispatch(Exti::get_group(1U));
+}
+
+/**
+ *  EXTI line 2 interrupt handler, overriding the weak default.
+ */
+void exti2_handler() {
+    dispatch(Exti::get_group(2U));
+}
+
+/**
+ *  EXTI line 3 interrupt handler, overriding the weak default.
+ */
+void exti3_handler() {
+    dispatch(Exti::get_group(3U));
+}
+
+/**
+ *  EXTI line 4 interrupt handler, overriding the weak default.
+ */
+void exti4_handler() {
+    dispatch(Exti::get_group(4U));
+}
+
+/**
+ *  EXTI lines 5 to 9 interrupt handler, overriding the weak default.
+ */
+void exti9_5_handler() {
+    dispatch(Exti::get_group(5U));
+}
+
+/**
+ *  EXTI lines 10 to 15 interrupt handler, overriding the weak default.
+ */
+void exti15_10_handler() {
+    dispatch(Exti::get_group(10U));
+}
+
+void Exti::enable_interrupt(const uint8_t& port_nr, const uint8_t& line, const Edge& edge, Callback callback) const {
+    callbacks[line] = callback;
+    select(port_nr, line, edge);
+    clear_pending(line);
+    Memory_bit<Access_policy::read_write>(imr, line).set();
+    nvic.enable(get_irq(line));
+}
+
+void Exti::enable_event(const uint8_t& port_nr, const uint8_t& line, const Edge& edge) const {
+    select(port_nr, line, edge);
+    Memory_bit<Access_policy::read_write>(emr, line).set();
+}
+
+void Exti::disable(const uint8_t& line) const {
+    Memory_bit<Access_policy::read_write>(imr, line).clear();
+    Memory_bit<Access_policy::read_write>(emr, line).clear();
+    Memory_bit<Access_policy::read_write>(rtsr, line).clear();
+    Memory_bit<Access_policy::read_write>(ftsr, line).clear();
+    if((imr & get_group(line)) == 0UL) {
+        nvic.disable(get_irq(line));
+    }
+    clear_pending(line);
+    callbacks[line] = nullptr;
+}
+
+void Exti::trigger(const uint8_t& line) const {
+    swier = (1UL << line);
+}
+
+bool Exti::is_pending(const uint8_t& line) const {
+    return (((pr >> line) & 1UL) != 0UL);
+}
+
+void Exti::clear_pending(const uint8_t& line) const {
+    pr = (1UL << line);
+}
+
+void Exti::select(const uint8_t& port_nr, const uint8_t& line, const Edge& edge) const {
+    rcc.enable(Rcc::Peripheral::afio);
+    const Memory_register<Access_policy::read_write> exticr(afio_address + 0x08UL + (4UL * (line / 4UL)));
+    exticr = masked_write(exticr, 15UL, port_nr, (4UL * (line % 4UL)));
+    Memory_bit<Access_policy::read_write>(rtsr, line) = ((static_cast<uint8_t>(edge) & 1U) != 0U);
+    Memory_bit<Access_policy::read_write>(ftsr, line) = ((static_cast<uint8_t>(edge) & 2U) != 0U);
+}
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -6,20 +6,31 @@ namespace hal {
 
 namespace stm32f10xxx {
 
+void Flash::config(const uint32_t& sysclk, const bool& half_cycle) const {
+    const bool use_half_cycle = half_cycle && (sysclk <= half_cycle_max);
+    acr.modify(Acr::latency::value(latency(sysclk))
+             | Acr::hlfcya::value(use_half_cycle)
+             | Acr::prftbe::value(!use_half_cycle));
+}
+
 void Flash::set_latency(const uint8_t& latency) const {
-    switch(latency) {
-    case 0:
-        acr = masked_write(acr, create_mask(3UL), 0UL, 0UL);
-        break;
-    case 1:
-        acr = masked_write(acr, create_mask(3UL), 1UL, 0UL);
-        break;
-    case 2:
-        acr = masked_write(acr, create_mask(3UL), 2UL, 0UL);
-        break;
+    if(latency <= 2U) {
+        acr.modify(Acr::latency::value(latency));
     }
 }
 
+uint8_t Flash::get_latency() const {
+    return acr.read<Acr::latency>();
+}
+
+bool Flash::is_half_cycle() const {
+    return acr.read<Acr::hlfcya>();
+}
+
+bool Flash::is_prefetching() const {
+    return acr.read<Acr::prftbs>();
+}
+
 
 } /* namespace stm32f10xxx */
 
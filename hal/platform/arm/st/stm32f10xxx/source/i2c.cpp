@@ -0,0 +1,391 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    i2c.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Inter-integrated circuit bus master.
+ */
+
+/* System. */
+#include <array>            /* Port states. */
+
+/* Third-party. */
+
+/* Local. */
+#include "i2c.hpp"
+#include "timebase.hpp"
+#include "dwt.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+namespace {
+
+const std::size_t port_count = 2U;          /**< I2C1 and I2C2.                 */
+const uint32_t standard_hz = 100'000UL;     /**< Maximum standard mode clock.   */
+const uint32_t fast_hz = 400'000UL;         /**< Maximum fast mode clock.       */
+const uint32_t recovery_clocks = 9UL;       /**< Clocks releasing any device.   */
+const uint32_t recovery_us = 5UL;           /**< Half period of recovery clock. */
+
+/**
+ *  Request queue and progress of a port.
+ */
+struct Port_state {
+    I2c::Request* volatile head;        /**< Request in progress.           */
+    I2c::Request*          tail;        /**< Last queued request.           */
+    uint16_t               done;        /**< Bytes of the current phase.    */
+    bool                   reading;     /**< In the read phase.             */
+    bool                   restart;     /**< Next request follows at once.  */
+    volatile bool          stalled;     /**< Head waits for thread context. */
+    uint32_t               stop_cycles; /**< SCL period in HCLK cycles.     */
+};
+
+std::array<Port_state, port_count> states;     /**< State per port. */
+
+} /* namespace */
+
+/**
+ *  I2C1 event interrupt handler, overriding the weak default.
+ */
+void i2c1_ev_handler() {
+    i2c1.handle_event();
+}
+
+/**
+ *  I2C1 error interrupt handler, overriding the weak default.
+ */
+void i2c1_er_handler() {
+    i2c1.handle_error();
+}
+
+/**
+ *  I2C2 event interrupt handler, overriding the weak default.
+ */
+void i2c2_ev_handler() {
+    i2c2.handle_event();
+}
+
+/**
+ *  I2C2 error interrupt handler, overriding the weak default.
+ */
+void i2c2_er_handler() {
+    i2c2.handle_error();
+}
+
+bool I2c::initialize(const uint32_t& hz) const {
+    const uint32_t pclk = rcc.get_clock().pclk1;
+    const uint32_t mhz = (pclk / 1'000'000UL);
+    if((hz == 0UL) || (hz > fast_hz) || (mhz < 2UL) || (mhz > 36UL) || ((hz > standard_hz) && (mhz < 4UL))) {
+        return false;
+    }
+
+    port.initialize();
+    port.config_pins((1UL << scl) | (1UL << sda), Pin::Config::alternate_opendrain);
+    rcc.enable(peripheral);
+    cr1.write(Cr1::pe::clear());
+
+    /* Round the divider up, so the clock does not exceed the request. */
+    uint32_t period = 0UL;
+    if(hz <= standard_hz) {
+        uint32_t divider = ((pclk + (2UL * hz) - 1UL) / (2UL * hz));
+        divider = (divider < 4UL) ? 4UL : divider;
+        ccr = divider;
+        trise = (mhz + 1UL);
+        period = (2UL * divider);
+    } else {
+        const uint32_t divider = ((pclk + (3UL * hz) - 1UL) / (3UL * hz));
+        ccr = (1UL << 15UL) | divider;
+        trise = (((mhz * 300UL) / 1000UL) + 1UL);
+        period = (3UL * divider);
+    }
+    states[index].stop_cycles = (period * (rcc.get_clock().hclk / pclk));
+    cr2.write(Cr2::freq::value(mhz));
+    reset();
+
+    nvic.enable(event_irq);
+    nvic.enable(error_irq);
+    return true;
+}
+
+bool I2c::submit(Request& request) const {
+    if(request.status == Status::pending) {
+        return false;
+    }
+    request.status = Status::pending;
+    request.next = nullptr;
+
+    /* Keep the interrupts from advancing the queue meanwhile. */
+    nvic.disable(event_irq);
+    nvic.disable(error_irq);
+    Port_state& state = states[index];
+    if(state.head == nullptr) {
+        state.head = &request;
+        state.tail = &request;
+        state.stalled = !start(request);
+    } else {
+        state.tail->next = &request;
+        state.tail = &request;
+    }
+    nvic.enable(event_irq);
+    nvic.enable(error_irq);
+    return true;
+}
+
+I2c::Status I2c::transfer(const uint8_t& address, const uint8_t* tx, const uint16_t& tx_count,
+                          uint8_t* rx, const uint16_t& rx_count) const {
+    Request request = {address, tx, tx_count, rx, rx_count, nullptr, Status::idle, nullptr};
+    submit(request);
+    while(request.status == Status::pending) {
+        resume();
+    }
+    return request.status;
+}
+
+bool I2c::is_busy() const {
+    resume();
+    return (states[index].head != nullptr);
+}
+
+void I2c::wait() const {
+    while(is_busy()) {
+    }
+}
+
+void I2c::handle_event() const {
+    Port_state& state = states[index];
+    Request* const request = state.head;
+    if(request == nullptr) {
+        cr2.modify(Cr2::itbufen::clear());
+        return;
+    }
+
+    /* The last byte of a request is taken before the start of the next. */
+    if(cr2.read<Cr2::itbufen>()) {
+        if(!state.reading && sr1.read<Sr1::txe>()) {
+            dr = request->tx[state.done++];
+            if(state.done == request->tx_count) {
+                cr2.modify(Cr2::itbufen::clear());
+            }
+            return;
+        }
+        if(state.reading && sr1.read<Sr1::rxne>()) {
+            request->rx[state.done++] = static_cast<uint8_t>(dr);
+            const uint16_t remaining = static_cast<uint16_t>(request->rx_count - state.done);
+            if(remaining == 0U) {
+                finish(Status::done);
+            } else if(remaining == 3U) {
+                /* The last three bytes are taken on BTF, to NACK in time. */
+                cr2.modify(Cr2::itbufen::clear());
+            }
+            return;
+        }
+    }
+
+    if(sr1.read<Sr1::sb>()) {
+        dr = ((static_cast<uint32_t>(request->address) << 1UL) | (state.reading ? 1UL : 0UL));
+        return;
+    }
+
+    if(sr1.read<Sr1::addr>()) {
+        state.done = 0U;
+        if(!state.reading) {
+            static_cast<void>(static_cast<uint32_t>(sr2));
+            if(request->tx_count == 0U) {
+                release();
+                finish(Status::done);
+                return;
+            }
+            dr = request->tx[state.done++];
+            cr2.modify(Cr2::itbufen::value(state.done < request->tx_count));
+            return;
+        }
+        /* ACK, POS and the end of short reads are set around clearing ADDR. */
+        if(request->rx_count == 1U) {
+            cr1.modify(Cr1::ack::clear() | Cr1::pos::clear());
+            static_cast<void>(static_cast<uint32_t>(sr2));
+            release();
+            cr2.modify(Cr2::itbufen::set());
+        } else if(request->rx_count == 2U) {
+            cr1.modify(Cr1::ack::clear() | Cr1::pos::set());
+            static_cast<void>(static_cast<uint32_t>(sr2));
+        } else {
+            cr1.modify(Cr1::ack::set() | Cr1::pos::clear());
+            static_cast<void>(static_cast<uint32_t>(sr2));
+            cr2.modify(Cr2::itbufen::value(request->rx_count > 3U));
+        }
+        return;
+    }
+
+    /* BTF stays set until a requested repeated start is generated. */
+    if(sr1.read<Sr1::btf>() && !cr1.read<Cr1::start>()) {
+        if(!state.reading) {
+            if(request->rx_count > 0U) {
+                state.reading = true;
+                state.done = 0U;
+                cr1.modify(Cr1::start::set());
+            } else {
+                release();
+                finish(Status::done);
+            }
+            return;
+        }
+        const uint16_t remaining = static_cast<uint16_t>(request->rx_count - state.done);
+        if(remaining == 2U) {
+            release();
+            request->rx[state.done++] = static_cast<uint8_t>(dr);
+            request->rx[state.done++] = static_cast<uint8_t>(dr);
+            finish(Status::done);
+        } else if(remaining == 3U) {
+            cr1.modify(Cr1::ack::clear());
+            request->rx[state.done++] = static_cast<uint8_t>(dr);
+            release();
+            request->rx[state.done++] = static_cast<uint8_t>(dr);
+            cr2.modify(Cr2::itbufen::set());
+        }
+    }
+}
+
+void I2c::handle_error() const {
+    const uint32_t errors = (sr1 & (Sr1::berr::mask() | Sr1::arlo::mask() | Sr1::af::mask()
+                                    | Sr1::ovr::mask() | Sr1::timeout::mask()));
+    /* Error flags are cleared by writing zero, the others ignore writes. */
+    sr1 = ~errors;
+    Port_state& state = states[index];
+    if(state.head == nullptr) {
+        return;
+    }
+    if((errors & (Sr1::berr::mask() | Sr1::ovr::mask() | Sr1::timeout::mask())) != 0UL) {
+        /* The reset drops a requested repeated start. */
+        reset();
+        state.restart = false;
+        finish(Status::bus_error);
+    } else if((errors & Sr1::arlo::mask()) != 0UL) {
+        /* The port already fell back to slave mode. */
+        state.restart = false;
+        finish(Status::arbitration_lost);
+    } else if((errors & Sr1::af::mask()) != 0UL) {
+        release();
+        finish(Status::nack);
+    }
+}
+
+void I2c::resume() const {
+    Port_state& state = states[index];
+    if(!state.stalled) {
+        return;
+    }
+    /* The interrupts leave a stalled queue alone, the bus is ours. */
+    while(cr1.read<Cr1::stop>()) {
+    }
+    if(sr2.read<Sr2::busy>()) {
+        recover();
+    }
+    state.stalled = !start(*state.head);
+}
+
+bool I2c::start(const Request& request) const {
+    /* CR1 is not written while a stop condition is still generated. The
+       stop of the previous request, e.g. submitting from its done
+       callback, ends within a clock period. */
+    const uint32_t since = dwt.get_cycles();
+    while(cr1.read<Cr1::stop>()) {
+        if((dwt.get_cycles() - since) >= states[index].stop_cycles) {
+            return false;
+        }
+    }
+    if(sr2.read<Sr2::busy>()) {
+        return false;
+    }
+    prepare(request);
+    cr1.modify(Cr1::ack::set() | Cr1::pos::clear() | Cr1::start::set());
+    return true;
+}
+
+void I2c::prepare(const Request& request) const {
+    Port_state& state = states[index];
+    state.reading = ((request.tx_count == 0U) && (request.rx_count > 0U));
+    state.done = 0U;
+}
+
+void I2c::release() const {
+    Port_state& state = states[index];
+    state.restart = (state.head->next != nullptr);
+    cr1.modify(state.restart ? Cr1::start::set() : Cr1::stop::set());
+}
+
+void I2c::finish(const Status& status) const {
+    Port_state& state = states[index];
+    Request* const request = state.head;
+    cr2.modify(Cr2::itbufen::clear());
+
+    /* The next request follows its repeated start, or waits for the bus.
+       An error may also end a stalled head. */
+    state.head = request->next;
+    state.stalled = false;
+    if(state.head != nullptr) {
+        if(state.restart) {
+            prepare(*state.head);
+        } else {
+            state.stalled = true;
+        }
+    }
+    state.restart = false;
+    request->status = status;
+    if(request->done != nullptr) {
+        request->done(*request);
+    }
+}
+
+void I2c::reset() const {
+    /* The software reset clears the configuration as well. */
+    const uint32_t clock = ccr;
+    const uint32_t rise = trise;
+    const uint32_t freq = cr2.read<Cr2::freq>();
+    cr1.write(Cr1::swrst::set());
+    cr1.write(Cr1::swrst::clear());
+    ccr = clock;
+    trise = rise;
+    cr2.write(Cr2::freq::value(freq) | Cr2::iterren::set() | Cr2::itevten::set());
+    cr1.write(Cr1::pe::set());
+}
+
+void I2c::recover() const {
+    const uint32_t clock_pin = (1UL << scl);
+    const uint32_t data_pin = (1UL << sda);
+    cr1.write(Cr1::pe::clear());
+    port.set_pins(clock_pin | data_pin);
+    port.config_pins(clock_pin | data_pin, Pin::Config::output_opendrain);
+
+    /* A device holding SDA low releases it within a byte and an ACK. */
+    for(uint32_t i = 0UL; (i < recovery_clocks) && ((port.read_pins() & data_pin) == 0UL); i++) {
+        port.clear_pins(clock_pin);
+        timebase.delay_us(recovery_us);
+        port.set_pins(clock_pin);
+        timebase.delay_us(recovery_us);
+    }
+    port.clear_pins(clock_pin);
+    timebase.delay_us(recovery_us);
+    port.clear_pins(data_pin);
+    timebase.delay_us(recovery_us);
+    port.set_pins(clock_pin);
+    timebase.delay_us(recovery_us);
+    port.set_pins(data_pin);
+    timebase.delay_us(recovery_us);
+
+    port.config_pins(clock_pin | data_pin, Pin::Config::alternate_opendrain);
+    reset();
+}
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -14,6 +14,8 @@
 #include "stack.hpp"
 #include "startup.hpp"
 #include "interrupts.hpp"
+#include "vector_table.hpp"
+#include "noinit.hpp"
 
 namespace bmpp {
 
@@ -117,6 +119,58 @@ const std::array<void(*)(), 76> irq_vector = {
     dma2_channel4_5_handler
 };
 
+static_assert(std::tuple_size<decltype(irq_vector)>::value == (16U + irq_count),
+              "Vector table does not match the interrupt numbers.");
+
+/**
+   @brief  Vector table in RAM, aligned to its size rounded up to a power
+           of two as VTOR requires. Completely written on relocation, so
+           it is not cleared at startup.
+*/
+alignas(512) BMPP_NOINIT
+static std::array<Handler, 16U + irq_count> ram_vector;
+
+void relocate_vector_table() {
+    if(is_vector_table_relocated()) {
+        return;
+    }
+    for(std::size_t i = 0UL; i < ram_vector.size(); i++) {
+        ram_vector[i] = irq_vector[i];
+    }
+    cortex_m3::set_vector_table(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(ram_vector.data())));
+}
+
+bool is_vector_table_relocated() {
+    return (cortex_m3::get_vector_table() == static_cast<uint32_t>(reinterpret_cast<uintptr_t>(ram_vector.data())));
+}
+
+Handler set_handler(const Irq& irq, const Handler& handler) {
+    relocate_vector_table();
+    const std::size_t index = 16U + static_cast<std::size_t>(irq);
+    const Handler previous = ram_vector[index];
+    ram_vector[index] = handler;
+    asm volatile ("dsb" : : : "memory");
+    return previous;
+}
+
+Handler set_handler(const cortex_m3::Exception& exception, const Handler& handler) {
+    relocate_vector_table();
+    const std::size_t index = static_cast<std::size_t>(16 + static_cast<int32_t>(exception));
+    const Handler previous = ram_vector[index];
+    ram_vector[index] = handler;
+    asm volatile ("dsb" : : : "memory");
+    return previous;
+}
+
+Handler get_handler(const Irq& irq) {
+    const std::size_t index = 16U + static_cast<std::size_t>(irq);
+    return is_vector_table_relocated() ? ram_vector[index] : irq_vector[index];
+}
+
+void restore_handler(const Irq& irq) {
+    set_handler(irq, irq_vector[16U + static_cast<std::size_t>(irq)]);
+}
+
 /**
    @} End of group Vectors.
  */
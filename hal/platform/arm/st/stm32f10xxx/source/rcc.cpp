@@ -1,5 +1,3 @@
-#include <array>
-
 #include "rcc.hpp"
 #include "flash.hpp"
 
@@ -9,45 +7,131 @@ namespace hal {
 
 namespace stm32f10xxx {
 
-void Rcc::set_clock(const uint32_t & hz) const {
+namespace {
+
+/**
+ *  Clock configuration after reset, running from HSI.
+ */
+Clock_config current_clock = solve_clock(0UL, Clock_limits::hsi, Clock_limits::hsi,
+                                         Clock_limits::hsi, Clock_limits::hsi);
+
+} /* namespace */
+
+bool Rcc::set_clock(const uint32_t & hz) const {
+    const uint32_t pclk1 = (hz > Clock_limits::pclk1_max) ? (hz / 2UL) : hz;
+#if defined(EXTCLK)
+    const Clock_config config = solve_clock(EXTCLK, hz, hz, pclk1, hz);
+#else
+    const Clock_config config = solve_clock(0UL, hz, hz, pclk1, hz);
+#endif
+    if(!config.valid()) {
+        return false;
+    }
+    set_clock(config);
+    return true;
+}
+
+void Rcc::set_clock(const Clock_config& config) const {
+
+    /* Flash access safe for both the current and the new clock. */
+    flash.config((config.sysclk > current_clock.sysclk) ? config.sysclk : current_clock.sysclk);
 
-    (void) hz;
+    const bool use_hse = (config.sw == 1UL) || ((config.sw == 2UL) && (config.pllsrc == 1UL));
 
-    /* Enable Clock security system. */
-    /* Enable HSE. */
-    cr |= ((1UL << 19UL) | (1UL << 16UL));
+    if(use_hse) {
+        /* Enable Clock security system. */
+        /* Enable HSE. */
+        cr.modify(Cr::csson::set() | Cr::hseon::set());
 
-    while(!(cr & (1UL << 17UL))) {
-        /* Wait for HSE Ready. */
+        while(!cr.read<Cr::hserdy>()) {
+            /* Wait for HSE Ready. */
+        }
     }
 
-    /* HSE as pll clock source. */
-    /* Multiply by 6. */
-    cfgr |= ((1U << 16U) | (4U << 18U));
+    /* Leave the PLL for HSI before touching the prescalers, which would
+     * otherwise briefly divide the PLL clock by the new, possibly lower,
+     * ratios. The PLL is only reconfigured while off. */
+    if(cfgr.read<Cfgr::sws>() == Sysclk_source::pll) {
+        cfgr.modify(Cfgr::sw::value(Sysclk_source::hsi));
+        while(cfgr.read<Cfgr::sws>() != Sysclk_source::hsi) {
+            /* Wait for system clock to switch source. */
+        }
+    }
 
-    /* Enable PLL */
-    cr |= (1UL << 24UL);
+    /* Disable PLL. */
+    cr.modify(Cr::pllon::clear());
+    while(cr.read<Cr::pllrdy>()) {
+        /* Wait for PLL to stop. */
+    }
 
-    while(!(cr & (1UL << 25UL))) {
-        /* Wait for PLL Ready. */
+    /* Prescalers and PLL source and multiplier in one update. */
+    cfgr.modify(Cfgr::hpre::value(config.hpre)
+              | Cfgr::ppre1::value(config.ppre1)
+              | Cfgr::ppre2::value(config.ppre2)
+              | Cfgr::adcpre::value(config.adcpre)
+              | Cfgr::pllsrc::value(static_cast<Pll_source>(config.pllsrc))
+              | Cfgr::pllxtpre::value(config.pllxtpre != 0UL)
+              | Cfgr::pllmul::value(config.pllmul)
+              | Cfgr::usbpre::value(config.usbpre != 0UL));
+
+    if(config.sw == 2UL) {
+        /* Enable PLL */
+        cr.modify(Cr::pllon::set());
+
+        while(!cr.read<Cr::pllrdy>()) {
+            /* Wait for PLL Ready. */
+        }
     }
 
-    /* Set flash latency to two wait states. */
-    flash.set_latency(2);
 
-    /* Set pll as main source. */
-    cfgr |= 2U;
-    while(!((cfgr & (3U << 2U)) & (2U << 2U))) {
+    /* Switch system clock source. */
+    const Sysclk_source source = static_cast<Sysclk_source>(config.sw);
+    cfgr.modify(Cfgr::sw::value(source));
+    while(cfgr.read<Cfgr::sws>() != source) {
         /* Wait for system clock to switch source. */
     }
+
+    /* Flash access for the new clock. */
+    flash.config(config.sysclk, Flash::half_cycle(config.sysclk, config.hclk));
+
+    current_clock = config;
+}
+
+const Clock_config& Rcc::get_clock() const {
+    return current_clock;
 }
 
 void Rcc::enable_gpio(const uint8_t& port_nr) const {
-    apb2enr |= (1UL << (port_nr + 2UL));
+    Memory_bit<Access_policy::read_write>(apb2enr, (port_nr + 2UL)).set();
 }
 
 void Rcc::disable_gpio(const uint8_t & port_nr) const {
-    apb2enr &= ~(1UL << (port_nr + 2UL));
+    Memory_bit<Access_policy::read_write>(apb2enr, (port_nr + 2UL)).clear();
+}
+
+void Rcc::enable(const Peripheral& peripheral) const {
+    enable_bit(peripheral).set();
+}
+
+void Rcc::disable(const Peripheral& peripheral) const {
+    enable_bit(peripheral).clear();
+}
+
+bool Rcc::is_enabled(const Peripheral& peripheral) const {
+    return enable_bit(peripheral).get();
+}
+
+Memory_bit<Access_policy::read_write> Rcc::enable_bit(const Peripheral& peripheral) const {
+    const uint32_t code = static_cast<uint32_t>(peripheral);
+    const uint32_t bit = (code & 0x1FUL);
+    switch(code >> 8UL) {
+    case 0UL:
+        return Memory_bit<Access_policy::read_write>(ahbenr, bit);
+    case 1UL:
+        return Memory_bit<Access_policy::read_write>(apb2enr, bit);
+    default:
+        return Memory_bit<Access_policy::read_write>(apb1enr, bit);
+    }
 }
 
 } /* namespace stm32f10xxx */
@@ -0,0 +1,203 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    spi.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Serial peripheral interface master.
+ */
+
+/* System. */
+#include <array>            /* Port states. */
+
+/* Third-party. */
+
+/* Local. */
+#include "spi.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+namespace {
+
+const std::size_t port_count = 2U;      /**< SPI1 and SPI2. */
+
+/**
+ *  Transaction queue of a port.
+ */
+struct Port_state {
+    const Spi*                 port;    /**< Port serving the queue.    */
+    Spi::Transaction* volatile head;    /**< Transaction in progress.   */
+    Spi::Transaction*          tail;    /**< Last queued transaction.   */
+    Spi::Frame                 frame;   /**< Frame size.                */
+    uint16_t                   sink;    /**< Drained frames.            */
+};
+
+std::array<Port_state, port_count> states;     /**< State per port. */
+
+/**
+ *  DMA events ending a transaction.
+ *  @param[in]  context State of the port.
+ *  @param[in]  event   DMA event.
+ *  @return None.
+ */
+void on_event(void* context, const Dma_channel::Event&) {
+    static_cast<const Port_state*>(context)->port->handle_completion();
+}
+
+} /* namespace */
+
+bool Spi::initialize(const uint32_t& hz, const Mode& mode, const Frame& frame, const bool& lsb_first) const {
+    rcc.enable(peripheral);
+    const uint32_t clock = get_clock();
+    /* The serial clock is PCLK divided by 2 to 256. */
+    uint32_t divider = 0UL;
+    while((clock >> (divider + 1UL)) > hz) {
+        if(++divider > 7UL) {
+            return false;
+        }
+    }
+    states[index].port = this;
+    states[index].frame = frame;
+    cr2.write(Cr2::rxdmaen::clear() | Cr2::txdmaen::clear());
+    cr1.write(Cr1::cpha::value((static_cast<uint8_t>(mode) & 1U) != 0U)
+              | Cr1::cpol::value((static_cast<uint8_t>(mode) & 2U) != 0U)
+              | Cr1::mstr::set()
+              | Cr1::br::value(divider)
+              | Cr1::lsbfirst::value(lsb_first)
+              | Cr1::ssi::set()
+              | Cr1::ssm::set()
+              | Cr1::dff::value(frame == Frame::bits16));
+    cr1.modify(Cr1::spe::set());
+    return true;
+}
+
+uint32_t Spi::get_clock() const {
+    const Clock_config& clock = rcc.get_clock();
+    return ((static_cast<uint32_t>(peripheral) >> 8UL) == 1UL) ? clock.pclk2 : clock.pclk1;
+}
+
+uint32_t Spi::get_rate() const {
+    return (get_clock() >> (cr1.read<Cr1::br>() + 1UL));
+}
+
+bool Spi::submit(Transaction& transaction) const {
+    if(transaction.pending || (transaction.count == 0U)) {
+        return false;
+    }
+    transaction.pending = true;
+    transaction.next = nullptr;
+
+    /* Keep the DMA interrupts from advancing the queue meanwhile. */
+    const bool rx_irq = nvic.is_enabled(rx_dma.get_irq());
+    const bool tx_irq = nvic.is_enabled(tx_dma.get_irq());
+    nvic.disable(rx_dma.get_irq());
+    nvic.disable(tx_dma.get_irq());
+
+    Port_state& state = states[index];
+    if(state.head == nullptr) {
+        state.head = &transaction;
+        state.tail = &transaction;
+        start(transaction);
+    } else {
+        state.tail->next = &transaction;
+        state.tail = &transaction;
+    }
+    if(rx_irq) {
+        nvic.enable(rx_dma.get_irq());
+    }
+    if(tx_irq) {
+        nvic.enable(tx_dma.get_irq());
+    }
+    return true;
+}
+
+bool Spi::transfer(const void* tx, void* rx, const uint16_t& count, const Gpio* cs_port, const uint16_t& cs_pins) const {
+    Transaction transaction = {tx, rx, count, cs_port, cs_pins, nullptr, false, nullptr};
+    if(!submit(transaction)) {
+        return false;
+    }
+    while(transaction.pending) {
+    }
+    return true;
+}
+
+bool Spi::is_busy() const {
+    return (states[index].head != nullptr);
+}
+
+void Spi::wait() const {
+    while(is_busy()) {
+    }
+}
+
+void Spi::handle_completion() const {
+    Port_state& state = states[index];
+    Transaction* const transaction = state.head;
+    if(transaction == nullptr) {
+        return;
+    }
+
+    /* Every frame has been received, so the bus is idle. */
+    cr2.write(Cr2::rxdmaen::clear() | Cr2::txdmaen::clear());
+    rx_dma.stop();
+    tx_dma.stop();
+    if(transaction->cs_port != nullptr) {
+        transaction->cs_port->set_pins(transaction->cs_pins);
+    }
+
+    /* Start the next transaction before reporting, to keep the bus busy. */
+    state.head = transaction->next;
+    if(state.head != nullptr) {
+        start(*state.head);
+    }
+    transaction->pending = false;
+    if(transaction->done != nullptr) {
+        transaction->done(*transaction);
+    }
+}
+
+void Spi::start(Transaction& transaction) const {
+    const bool duplex = (transaction.rx != nullptr);
+    if(transaction.cs_port != nullptr) {
+        transaction.cs_port->clear_pins(transaction.cs_pins);
+    }
+
+    /* The last received frame reports the end of the transaction. */
+    Port_state& state = states[index];
+    rx_dma.set_callback(on_event, &state);
+    tx_dma.set_callback(nullptr);
+    rx_dma.set_priority(Dma_channel::Priority::very_high);
+    tx_dma.set_priority(Dma_channel::Priority::high);
+
+    if(state.frame == Frame::bits16) {
+        if(duplex) {
+            rx_dma.receive(dr.get_address(), static_cast<uint16_t*>(transaction.rx), transaction.count);
+        } else {
+            rx_dma.discard(dr.get_address(), &state.sink, transaction.count);
+        }
+        tx_dma.transmit(static_cast<const uint16_t*>(transaction.tx), dr.get_address(), transaction.count);
+    } else {
+        if(duplex) {
+            rx_dma.receive(dr.get_address(), static_cast<uint8_t*>(transaction.rx), transaction.count);
+        } else {
+            rx_dma.discard(dr.get_address(), reinterpret_cast<uint8_t*>(&state.sink), transaction.count);
+        }
+        tx_dma.transmit(static_cast<const uint8_t*>(transaction.tx), dr.get_address(), transaction.count);
+    }
+    /* Frames are requested once both channels are ready. */
+    cr2.write(Cr2::rxdmaen::set() | Cr2::txdmaen::set());
+}
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -1,46 +1,143 @@
 #include <cstdint>
 
 #include "startup.hpp"
+#include "vector_table.hpp"
+#include "stack.hpp"
+#include "dwt.hpp"
+#include "noinit.hpp"
 
-extern uint8_t* __data_init_start;
-extern uint8_t* __data_start;
-extern uint8_t* __data_end;
+/* Section boundaries, word aligned by the linker script. */
+extern uint32_t __data_init_start[];
+extern uint32_t __data_start[];
+extern uint32_t __data_end[];
 
-extern uint8_t* __fastcode_init_start;
-extern uint8_t* __fastcode_start;
-extern uint8_t* __fastcode_end;
+extern uint32_t __fastcode_init_start[];
+extern uint32_t __fastcode_start[];
+extern uint32_t __fastcode_end[];
 
-extern uint8_t* __bss_start;
-extern uint8_t* __bss_end;
+extern uint32_t __bss_start[];
+extern uint32_t __bss_end[];
+
+extern uint32_t __preserved_start[];
+extern uint32_t __preserved_end[];
 
 extern int main();
 
-void reset_handler() {
+namespace {
+
+volatile uint32_t* const rcc_csr = reinterpret_cast<volatile uint32_t*>(0x4002'1024UL);  /**< RCC control/status. */
+
+const uint32_t rcc_csr_rmvf    = (1UL << 24);   /**< Remove reset flags.    */
+const uint32_t rcc_csr_porrstf = (1UL << 27);   /**< Power on reset flag.   */
+const uint32_t preserved_magic = 0x5741'524DUL; /**< Marks valid contents.  */
+
+uint32_t boot_cycles;   /**< Cycles from reset until main.  */
+uint32_t reset_flags;   /**< Reset flags of the last reset. */
+bool     warm_start;    /**< Preserved RAM was kept.        */
 
-    uint8_t* src = __data_init_start;
-    uint8_t* dst = __data_start;
-    uint8_t* end = __data_end;
+/**
+ *  Validates the .preserved section, placed first in it. The address,
+ *  size and layout version are included, so a layout change after a
+ *  firmware update is treated as invalid.
+ */
+[[gnu::section(".preserved.check")]]
+uint32_t preserved_check;
 
+/**
+ *  Expected value of preserved_check for this firmware.
+ *  @return Check value.
+ */
+uint32_t preserved_signature() {
+    uint32_t check = preserved_magic;
+    check = (check * 31UL) + static_cast<uint32_t>(reinterpret_cast<uintptr_t>(__preserved_start));
+    check = (check * 31UL) + static_cast<uint32_t>(__preserved_end - __preserved_start);
+    check = (check * 31UL) + static_cast<uint32_t>(BMPP_PRESERVED_VERSION);
+    return check;
+}
+
+/**
+ *  Copies words, four at a time so the loads and stores become block
+ *  transfers. Runs before .data exists, so it must not become a memcpy call.
+ *  @param[in]  src     Start of the source.
+ *  @param[out] dst     Start of the destination.
+ *  @param[in]  end     End of the destination.
+ *  @return None.
+ */
+[[gnu::optimize("no-tree-loop-distribute-patterns")]]
+void copy_words(const uint32_t* src, uint32_t* dst, const uint32_t* end) {
+    while((end - dst) >= 4) {
+        const uint32_t w0 = src[0];
+        const uint32_t w1 = src[1];
+        const uint32_t w2 = src[2];
+        const uint32_t w3 = src[3];
+        dst[0] = w0;
+        dst[1] = w1;
+        dst[2] = w2;
+        dst[3] = w3;
+        dst += 4;
+        src += 4;
+    }
     while(dst < end) {
-        *dst = *src;
-        dst++;
-        src++;
+        *dst++ = *src++;
     }
+}
 
-    src = __fastcode_init_start;
-    dst = __fastcode_start;
-    end = __fastcode_end;
-
+/**
+ *  Zeroes words, four at a time. Runs before .bss exists, so it must not
+ *  become a memset call.
+ *  @param[out] dst     Start of the destination.
+ *  @param[in]  end     End of the destination.
+ *  @return None.
+ */
+[[gnu::optimize("no-tree-loop-distribute-patterns")]]
+void fill_words(uint32_t* dst, const uint32_t* end) {
+    while((end - dst) >= 4) {
+        dst[0] = 0UL;
+        dst[1] = 0UL;
+        dst[2] = 0UL;
+        dst[3] = 0UL;
+        dst += 4;
+    }
     while(dst < end) {
-        *dst = *src;
-        dst++;
-        src++;
+        *dst++ = 0UL;
     }
+}
+
+} /* namespace */
+
+void reset_handler() {
+
+    /* Count cycles from here on. */
+    bmpp::hal::dwt.restart();
+
+    /* Reset flags accumulate until removed. */
+    const uint32_t flags = *rcc_csr;
+    *rcc_csr |= rcc_csr_rmvf;
 
-    for(dst = __bss_start; dst < __bss_end; dst++) {
-        *dst = 0U;
+    /* Preserved RAM survives any reset other than a power cycle. */
+    const uint32_t check = preserved_signature();
+    const bool warm = ((flags & rcc_csr_porrstf) == 0UL) && (preserved_check == check);
+
+    /* Mark unused stack for high-water mark measurement. */
+    bmpp::hal::cortex_m3::paint_main_stack();
+    bmpp::hal::cortex_m3::paint_process_stack();
+
+    copy_words(__data_init_start, __data_start, __data_end);
+    copy_words(__fastcode_init_start, __fastcode_start, __fastcode_end);
+    fill_words(__bss_start, __bss_end);
+    if(!warm) {
+        fill_words(__preserved_start, __preserved_end);
+        preserved_check = check;
     }
 
+#if defined(RAM_VECTORS) && (RAM_VECTORS != 0)
+    bmpp::hal::stm32f10xxx::relocate_vector_table();
+#endif
+
+    reset_flags = flags;
+    warm_start  = warm;
+    boot_cycles = bmpp::hal::dwt.get_cycles();
+
     main();
 
     while(true) {
@@ -48,3 +145,27 @@ void reset_handler() {
     }
 
 }
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+uint32_t get_boot_cycles() {
+    return boot_cycles;
+}
+
+bool is_warm_start() {
+    return warm_start;
+}
+
+uint32_t get_reset_flags() {
+    return reset_flags;
+}
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
@@ -0,0 +1,167 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    timebase.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Monotonic time base and delays.
+ */
+
+/* System. */
+
+/* Third-party. */
+
+/* Local. */
+#include "timebase.hpp"
+#include "systick.hpp"
+#include "dwt.hpp"
+#include "rcc.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+namespace {
+
+volatile uint32_t ticks_low;        /**< Ticks, low word.               */
+volatile uint32_t ticks_high;       /**< Ticks, high word.              */
+uint32_t          tick_rate;        /**< Ticks per second.              */
+uint32_t          hclk_rate;        /**< Processor cycles per second.   */
+uint32_t          cycles_per_us;    /**< Processor cycles per us.       */
+
+const uint32_t max_delay_cycles = 0x8000'0000UL;   /**< Longest single cycle delay. */
+
+/**
+ *  Reads both tick words consistently with the interrupt.
+ *  @param[out] low     Low word.
+ *  @param[out] high    High word.
+ *  @return None.
+ */
+inline void read_ticks(uint32_t& low, uint32_t& high) {
+    do {
+        high = ticks_high;
+        low  = ticks_low;
+    } while(high != ticks_high);
+}
+
+} /* namespace */
+
+/**
+ *  System tick timer interrupt handler, overriding the weak default.
+ */
+void systick_handler() {
+    const uint32_t low = ticks_low + 1UL;
+    ticks_low = low;
+    if(low == 0UL) {
+        ticks_high = ticks_high + 1UL;
+    }
+}
+
+bool Timebase::start(const uint32_t& tick_hz) const {
+    const uint32_t hclk = rcc.get_clock().hclk;
+    if((tick_hz == 0UL) || ((hclk % tick_hz) != 0UL)) {
+        return false;
+    }
+    /* Checked before anything changes, so a running time base goes on. */
+    const uint32_t period = (hclk / tick_hz);
+    if((period < 2UL) || (period > (cortex_m3::Systick::max_reload + 1UL))) {
+        return false;
+    }
+
+    systick.stop();
+    tick_rate     = tick_hz;
+    hclk_rate     = hclk;
+    cycles_per_us = hclk / 1'000'000UL;
+
+    dwt.enable();
+    return systick.start(period);
+}
+
+uint32_t Timebase::get_ticks() const {
+    return ticks_low;
+}
+
+uint64_t Timebase::get_ticks64() const {
+    uint32_t low;
+    uint32_t high;
+    read_ticks(low, high);
+    return ((static_cast<uint64_t>(high) << 32) | low);
+}
+
+uint64_t Timebase::get_micros() const {
+    if(tick_rate == 0UL) {
+        return 0ULL;
+    }
+    uint64_t ticks;
+    uint32_t value;
+    do {
+        ticks = get_ticks64();
+        const uint32_t before = systick.get_value();
+        /* A wrap not yet counted by the handler is one more tick, and the
+         * value read after the pending flag is from after that wrap. */
+        if(systick.is_pending()) {
+            value = systick.get_value();
+            ticks++;
+        } else {
+            value = before;
+        }
+    } while(ticks != (get_ticks64() + (systick.is_pending() ? 1ULL : 0ULL)));
+    /* Whole seconds apart, so the cycles of the last second stay exact. */
+    const uint32_t period = systick.get_period();
+    const uint64_t seconds = (ticks / tick_rate);
+    const uint64_t cycles = ((ticks % tick_rate) * period) + (period - 1UL - value);
+    return (seconds * 1'000'000ULL) + ((cycles * 1'000'000ULL) / hclk_rate);
+}
+
+uint64_t Timebase::get_millis() const {
+    if(tick_rate == 0UL) {
+        return 0ULL;
+    }
+    const uint64_t ticks = get_ticks64();
+    return ((ticks / tick_rate) * 1000ULL) + (((ticks % tick_rate) * 1000ULL) / tick_rate);
+}
+
+uint32_t Timebase::deadline(const uint32_t& ms) const {
+    /* Rounded up, plus one tick as the current tick is partly over. */
+    const uint64_t ticks = ((static_cast<uint64_t>(ms) * tick_rate) + 999ULL) / 1000ULL;
+    return (get_ticks() + static_cast<uint32_t>(ticks) + 1UL);
+}
+
+bool Timebase::is_expired(const uint32_t& deadline) const {
+    return (static_cast<int32_t>(get_ticks() - deadline) >= 0);
+}
+
+void Timebase::delay(const uint32_t& ms) const {
+    const uint32_t end = deadline(ms);
+    while(!is_expired(end)) {
+#if defined(ARM)
+        asm volatile ("wfi");
+#endif
+    }
+}
+
+void Timebase::delay_us(const uint32_t& us) const {
+    /* Long delays exceed the 32 bit cycle counter, so they are split. */
+    uint64_t cycles = (static_cast<uint64_t>(us) * cycles_per_us);
+    while(cycles > max_delay_cycles) {
+        dwt.delay(max_delay_cycles);
+        cycles -= max_delay_cycles;
+    }
+    dwt.delay(static_cast<uint32_t>(cycles));
+}
+
+void Timebase::delay_cycles(const uint32_t& cycles) const {
+    dwt.delay(cycles);
+}
+
+uint32_t Timebase::get_cycles_per_us() const {
+    return cycles_per_us;
+}
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
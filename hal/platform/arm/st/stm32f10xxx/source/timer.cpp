@@ -0,0 +1,84 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    timer.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Timer time base and update events.
+ */
+
+/* System. */
+
+/* Third-party. */
+
+/* Local. */
+#include "timer.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+void Timer::initialize() const {
+    rcc.enable(peripheral);
+}
+
+uint32_t Timer::get_clock() const {
+    const Clock_config& clock = rcc.get_clock();
+    const bool apb2 = ((static_cast<uint32_t>(peripheral) >> 8UL) == 1UL);
+    return apb2 ? clock.apb2_timclk() : clock.apb1_timclk();
+}
+
+bool Timer::set_rate(const uint32_t& hz) const {
+    if(hz == 0UL) {
+        return false;
+    }
+    /* A reload value of zero blocks the counter. */
+    const uint32_t counts = get_clock() / hz;
+    if(counts < 2UL) {
+        return false;
+    }
+    const uint32_t prescaler = ((counts - 1UL) / 0x1'0000UL);
+    if(prescaler > 0xFFFFUL) {
+        return false;
+    }
+    set_period(static_cast<uint16_t>(prescaler), static_cast<uint16_t>((counts / (prescaler + 1UL)) - 1UL));
+    return true;
+}
+
+void Timer::set_period(const uint16_t& prescaler, const uint16_t& reload) const {
+    psc = prescaler;
+    arr = reload;
+    /* Load the prescaler now, without requesting DMA or interrupts. */
+    cr1.modify(Cr1::urs::set());
+    egr = 1UL;
+    sr = 0UL;
+}
+
+uint32_t Timer::get_rate() const {
+    return (get_clock() / ((psc + 1UL) * (arr + 1UL)));
+}
+
+void Timer::start() const {
+    cnt = 0UL;
+    cr1.modify(Cr1::cen::set());
+}
+
+void Timer::stop() const {
+    cr1.modify(Cr1::cen::clear());
+}
+
+void Timer::set_update_dma(const bool& enable) const {
+    dier.modify(Dier::ude::value(enable));
+}
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
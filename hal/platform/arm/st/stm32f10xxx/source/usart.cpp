@@ -0,0 +1,199 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    usart.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Universal synchronous/asynchronous receiver/transmitter.
+ */
+
+/* System. */
+#include <array>            /* Port states. */
+
+/* Third-party. */
+
+/* Local. */
+#include "usart.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+namespace {
+
+const std::size_t port_count = 3U;      /**< USART1 to USART3. */
+
+/**
+ *  Buffers and notifications of a port.
+ */
+struct Port_state {
+    uint8_t*         ring;      /**< Receive ring buffer.               */
+    uint16_t         size;      /**< Size of the ring buffer.           */
+    uint16_t         tail;      /**< Position of the next byte to read. */
+    Usart::Notify    receive;   /**< Data received, or nullptr.         */
+    Usart::Notify    sent;      /**< Transmission done, or nullptr.     */
+};
+
+std::array<Port_state, port_count> states;     /**< State per port. */
+
+/**
+ *  Receive DMA events, a half or the whole ring filled.
+ *  @param[in]  context State of the port.
+ *  @param[in]  event   DMA event.
+ *  @return None.
+ */
+void on_receive(void* context, const Dma_channel::Event&) {
+    const Usart::Notify receive = static_cast<const Port_state*>(context)->receive;
+    if(receive != nullptr) {
+        receive();
+    }
+}
+
+/**
+ *  Transmit DMA events, the last byte handed to the port.
+ *  @param[in]  context State of the port.
+ *  @param[in]  event   DMA event.
+ *  @return None.
+ */
+void on_sent(void* context, const Dma_channel::Event&) {
+    const Usart::Notify sent = static_cast<const Port_state*>(context)->sent;
+    if(sent != nullptr) {
+        sent();
+    }
+}
+
+} /* namespace */
+
+/**
+ *  USART1 interrupt handler, overriding the weak default.
+ */
+void usart1_handler() {
+    usart1.handle_interrupt();
+}
+
+/**
+ *  USART2 interrupt handler, overriding the weak default.
+ */
+void usart2_handler() {
+    usart2.handle_interrupt();
+}
+
+/**
+ *  USART3 interrupt handler, overriding the weak default.
+ */
+void usart3_handler() {
+    usart3.handle_interrupt();
+}
+
+bool Usart::set_baud(const uint32_t& baud) const {
+    const uint32_t pclk = get_clock();
+    if(!is_valid(pclk, baud)) {
+        return false;
+    }
+    brr_ = brr(pclk, baud);
+    return true;
+}
+
+uint32_t Usart::get_clock() const {
+    const Clock_config& clock = rcc.get_clock();
+    return ((static_cast<uint32_t>(peripheral) >> 8UL) == 1UL) ? clock.pclk2 : clock.pclk1;
+}
+
+void Usart::start(uint8_t* ring, const uint16_t& size, Notify receive) const {
+    Port_state& state = states[index];
+    stop();
+    rcc.enable(peripheral);
+
+    state.ring = ring;
+    state.size = size;
+    state.tail = 0U;
+    state.receive = receive;
+
+    /* The ring is never stopped, unread bytes are overwritten. */
+    rx_dma.set_callback((receive != nullptr) ? on_receive : nullptr, &state, true);
+    rx_dma.set_priority(Dma_channel::Priority::very_high);
+    rx_dma.receive(dr.get_address(), ring, size, Dma_channel::Mode::circular);
+    tx_dma.set_priority(Dma_channel::Priority::high);
+
+    cr3.write(Cr3::dmar::set() | Cr3::dmat::set());
+    cr1.write(Cr1::ue::set() | Cr1::te::set() | Cr1::re::set() | Cr1::idleie::value(receive != nullptr));
+    if(receive != nullptr) {
+        nvic.enable(irq);
+    }
+}
+
+void Usart::stop() const {
+    nvic.disable(irq);
+    cr1.write(Cr1::ue::clear());
+    cr3.write(Cr3::dmar::clear() | Cr3::dmat::clear());
+    rx_dma.stop();
+    tx_dma.stop();
+}
+
+uint16_t Usart::available() const {
+    const Port_state& state = states[index];
+    if(state.size == 0U) {
+        return 0U;
+    }
+    /* The ring is written up to size minus the remaining count. */
+    const uint16_t head = static_cast<uint16_t>((state.size - rx_dma.get_remaining()) % state.size);
+    return static_cast<uint16_t>((head + state.size - state.tail) % state.size);
+}
+
+uint16_t Usart::read(uint8_t* data, const uint16_t& max) const {
+    Port_state& state = states[index];
+    uint16_t count = available();
+    if(count > max) {
+        count = max;
+    }
+    for(uint16_t i = 0U; i < count; i++) {
+        data[i] = state.ring[state.tail];
+        state.tail = static_cast<uint16_t>((state.tail + 1U) % state.size);
+    }
+    return count;
+}
+
+bool Usart::write(const uint8_t* data, const uint16_t& count, Notify sent) const {
+    if(is_writing()) {
+        return false;
+    }
+    states[index].sent = sent;
+    tx_dma.set_callback((sent != nullptr) ? on_sent : nullptr, &states[index]);
+    /* TC is cleared by writing zero, the other flags ignore writes of one. */
+    sr = ~Sr::tc::mask();
+    return tx_dma.transmit(data, dr.get_address(), count);
+}
+
+bool Usart::is_writing() const {
+    return tx_dma.is_busy();
+}
+
+void Usart::flush() const {
+    tx_dma.wait();
+    while(cr1.read<Cr1::te>() && !sr.read<Sr::tc>()) {
+    }
+}
+
+void Usart::handle_interrupt() const {
+    /* Reading SR, then DR, clears the idle flag. */
+    if(!sr.read<Sr::idle>()) {
+        return;
+    }
+    static_cast<void>(static_cast<uint32_t>(dr));
+    const Notify receive = states[index].receive;
+    if(receive != nullptr) {
+        receive();
+    }
+}
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
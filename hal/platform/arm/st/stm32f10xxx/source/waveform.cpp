@@ -0,0 +1,118 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    waveform.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Timer paced DMA waveform output on GPIO ports.
+ */
+
+/* System. */
+#include <array>            /* Stream states.   */
+
+/* Third-party. */
+
+/* Local. */
+#include "waveform.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+namespace {
+
+/**
+ *  Playback of a DMA channel.
+ */
+struct Playback {
+    const Timer*      timer;    /**< Timer pacing the output.       */
+    Waveform::Refill  refill;   /**< Refill of a stream, or nullptr. */
+    uint32_t*         words;    /**< Stream buffer.                 */
+    uint16_t          half;     /**< Words per half of the buffer.  */
+    Dma_channel::Mode mode;     /**< Single play or stream.         */
+};
+
+std::array<Playback, Dma_channel::channel_count> playbacks;     /**< Playback per channel. */
+
+/**
+ *  DMA events of a channel, refilling streams and ending single plays.
+ *  @param[in]  context Playback of the channel.
+ *  @param[in]  event   DMA event.
+ *  @return None.
+ */
+void on_event(void* context, const Dma_channel::Event& event) {
+    const Playback& playback = *static_cast<const Playback*>(context);
+    if((event == Dma_channel::Event::error) || (playback.mode == Dma_channel::Mode::normal)) {
+        /* The channel is disabled, or the last word has been written. */
+        playback.timer->stop();
+    } else if(playback.refill != nullptr) {
+        /* A stream without refill repeats its buffer. */
+        const uint16_t offset = (event == Dma_channel::Event::half) ? 0U : playback.half;
+        playback.refill(playback.words + offset, playback.half);
+    }
+}
+
+} /* namespace */
+
+bool Waveform::play(const Gpio& port, const uint32_t* words, const uint16_t& count, const uint32_t& hz) const {
+    return start(port, words, count, hz, nullptr, Dma_channel::Mode::normal);
+}
+
+bool Waveform::stream(const Gpio& port, uint32_t* words, const uint16_t& count, const uint32_t& hz, Refill refill) const {
+    if((count == 0U) || ((count % 2U) != 0U)) {
+        return false;
+    }
+    Playback& playback = playbacks[timer.get_update_dma().get_channel_nr() - 1U];
+    playback.words = words;
+    playback.half = static_cast<uint16_t>(count / 2U);
+    return start(port, words, count, hz, refill, Dma_channel::Mode::circular);
+}
+
+bool Waveform::is_playing() const {
+    return timer.get_update_dma().is_busy();
+}
+
+void Waveform::wait() const {
+    timer.get_update_dma().wait();
+}
+
+void Waveform::stop() const {
+    timer.stop();
+    timer.set_update_dma(false);
+    timer.get_update_dma().stop();
+}
+
+bool Waveform::start(const Gpio& port, const uint32_t* words, const uint16_t& count, const uint32_t& hz,
+                     Refill refill, const Dma_channel::Mode& mode) const {
+    const Dma_channel& dma = timer.get_update_dma();
+    const std::size_t index = (dma.get_channel_nr() - 1U);
+
+    stop();
+    timer.initialize();
+    if(!timer.set_rate(hz)) {
+        return false;
+    }
+
+    playbacks[index].timer = &timer;
+    playbacks[index].refill = refill;
+    playbacks[index].mode = mode;
+    dma.set_callback(on_event, &playbacks[index], (refill != nullptr));
+    dma.set_priority(Dma_channel::Priority::very_high);
+    dma.transmit(words, port.get_bsrr_address(), count, mode);
+
+    timer.set_update_dma(true);
+    timer.start();
+    return true;
+}
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,179 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    register_file.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Simulated register file for running the HAL on the host.
+ */
+
+#ifndef BMPP_HAL_HOST_REGISTER_FILE_HPP__
+#define BMPP_HAL_HOST_REGISTER_FILE_HPP__
+
+/* System. */
+#include <atomic>           /* Hook generation.     */
+#include <cstdint>          /* Fixed size integers. */
+#include <mutex>            /* Interrupt threads.   */
+
+/* Third-party. */
+
+
+/* Local. */
+
+namespace bmpp {
+
+namespace hal {
+
+namespace host {
+
+/**
+ *  Storage backend which maps peripheral addresses onto host memory.
+ *  Pages are allocated zero initialized on first access, so every
+ *  register reads as zero until written.
+ *
+ *  Hardware behaviour, e.g. a ready flag following its enable bit, is
+ *  modelled by hooks. A hook runs before every access of its register and
+ *  may update it, so a read sees the effect of the preceding writes.
+ *
+ *  Threads standing in for interrupts hold mutex() while they run, as do
+ *  hooks and the page table, so an interrupt falls between two register
+ *  accesses. Only the accesses through a mapped pointer, single words as on
+ *  the bus, are left unserialized.
+ */
+class Register_file {
+public:
+
+    static const uint32_t page_size = 0x1000UL;    /**< Size of a simulated page in bytes. */
+
+    /**
+     *  Models the hardware side of a register.
+     *  @param[in]      address Address of the register.
+     *  @param[in,out]  reg     Simulated register.
+     */
+    using Hook = void (*)(const uint32_t& address, volatile uint32_t& reg);
+
+    /**
+     *  Maps a register address onto a pointer in the simulated register file.
+     *  @param[in] address   Integer representative of the Memory address.
+     *  @return              Pointer to simulated IO Memory.
+     */
+    static inline volatile uint32_t* map(const uint32_t& address);
+
+    /**
+     *  Reads a single bit of a simulated register.
+     *  @param[in] address   Address of the register.
+     *  @param[in] bit       Bit position within the register.
+     *  @return              State of the bit.
+     */
+    static inline bool read_bit(const uint32_t& address, const uint32_t& bit);
+
+    /**
+     *  Writes a single bit of a simulated register.
+     *  @param[in] address   Address of the register.
+     *  @param[in] bit       Bit position within the register.
+     *  @param[in] value     State to write.
+     *  @return None.
+     */
+    static inline void write_bit(const uint32_t& address, const uint32_t& bit, const bool& value);
+
+    /**
+     *  Reads a simulated register.
+     *  @param[in] address   Address of the register.
+     *  @return              Current value of the register.
+     */
+    static uint32_t read(const uint32_t& address);
+
+    /**
+     *  Writes a simulated register, e.g. to preset status flags set by hardware.
+     *  @param[in] address   Address of the register.
+     *  @param[in] value     Value to write.
+     *  @return None.
+     */
+    static void write(const uint32_t& address, const uint32_t& value);
+
+    /**
+     *  Clears all simulated registers to zero, keeping the hooks.
+     *  @return None.
+     */
+    static void reset();
+
+    /**
+     *  Installs the hook of a register, replacing any previous one.
+     *  @param[in] address   Address of the register.
+     *  @param[in] hook      Hook, nullptr to remove.
+     *  @return None.
+     */
+    static void set_hook(const uint32_t& address, Hook hook);
+
+    /**
+     *  Lock of the hooks and the page table, held by interrupt threads.
+     *  @return Recursive mutex, hooks may access other registers.
+     */
+    static std::recursive_mutex& mutex();
+
+private:
+
+    static thread_local uint32_t  cached_page;        /**< Base address of the last mapped page.  */
+    static thread_local uint32_t* cached_words;       /**< Storage of the last mapped page.       */
+    static thread_local bool      cached_hooked;      /**< The last mapped page has hooks.        */
+    static thread_local uint32_t  cached_generation;  /**< Hook generation of the cached page.    */
+    static std::atomic<uint32_t>  generation;         /**< Changed with every installed hook.     */
+
+    /**
+     *  Looks up, or allocates, the page containing an address, and runs the
+     *  hook of the address.
+     *  @param[in] address   Address within the page.
+     *  @return              Pointer to the word at the address.
+     */
+    static volatile uint32_t* map_page(const uint32_t& address);
+
+    /**
+     *  Runs the hook of a register, if any.
+     *  @param[in] address   Address of the register.
+     *  @param[in] reg       Simulated register.
+     *  @return None.
+     */
+    static void run_hook(const uint32_t& address, volatile uint32_t* reg);
+
+};
+
+/******************************************************************************/
+/* Definitions.                                                               */
+/******************************************************************************/
+
+inline volatile uint32_t* Register_file::map(const uint32_t& address) {
+    if((cached_words == nullptr) || ((address & ~(page_size - 1UL)) != cached_page)
+       || (cached_generation != generation.load(std::memory_order_acquire))) {
+        return map_page(address);
+    }
+    volatile uint32_t* const reg = (cached_words + ((address & (page_size - 1UL)) / sizeof(uint32_t)));
+    /* Only pages with hooks look up the hook table. */
+    if(cached_hooked) {
+        run_hook(address, reg);
+    }
+    return reg;
+}
+
+inline bool Register_file::read_bit(const uint32_t& address, const uint32_t& bit) {
+    return (((*map(address)) >> bit) & 1UL);
+}
+
+inline void Register_file::write_bit(const uint32_t& address, const uint32_t& bit, const bool& value) {
+    if(value) {
+        *map(address) |= (1UL << bit);
+    } else {
+        *map(address) &= ~(1UL << bit);
+    }
+}
+
+} /* namespace host */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_HOST_REGISTER_FILE_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,144 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    register_file.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Simulated register file for running the HAL on the host.
+ */
+
+/* System. */
+#include <algorithm>        /* Fill.                  */
+#include <memory>           /* Unique pointer.        */
+#include <unordered_map>    /* Page table.            */
+
+/* Third-party. */
+
+/* Local. */
+#include "register_file.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace host {
+
+namespace {
+
+const uint32_t words_per_page = Register_file::page_size / sizeof(uint32_t);
+
+/**
+ *  Page table of the simulated address space, indexed by page base address.
+ *  @return Reference to the page table.
+ */
+std::unordered_map<uint32_t, std::unique_ptr<uint32_t[]>>& pages() {
+    static std::unordered_map<uint32_t, std::unique_ptr<uint32_t[]>> table;
+    return table;
+}
+
+/**
+ *  Hooks of the simulated registers, indexed by register address.
+ *  @return Reference to the hook table.
+ */
+std::unordered_map<uint32_t, Register_file::Hook>& hooks() {
+    static std::unordered_map<uint32_t, Register_file::Hook> table;
+    return table;
+}
+
+/**
+ *  Number of hooks per page, indexed by page base address.
+ *  @return Reference to the hook counts.
+ */
+std::unordered_map<uint32_t, uint32_t>& hooked_pages() {
+    static std::unordered_map<uint32_t, uint32_t> table;
+    return table;
+}
+
+thread_local bool in_hook = false;  /**< A hook is running, its accesses are not hooked. */
+
+} /* namespace */
+
+thread_local uint32_t  Register_file::cached_page       = 0UL;
+thread_local uint32_t* Register_file::cached_words      = nullptr;
+thread_local bool      Register_file::cached_hooked     = false;
+thread_local uint32_t  Register_file::cached_generation = 0UL;
+std::atomic<uint32_t>  Register_file::generation(0UL);
+
+uint32_t Register_file::read(const uint32_t& address) {
+    return *map(address);
+}
+
+void Register_file::write(const uint32_t& address, const uint32_t& value) {
+    *map(address) = value;
+}
+
+void Register_file::reset() {
+    std::lock_guard<std::recursive_mutex> lock(mutex());
+    for(auto& page : pages()) {
+        std::fill(page.second.get(), page.second.get() + words_per_page, 0UL);
+    }
+}
+
+void Register_file::set_hook(const uint32_t& address, Hook hook) {
+    const uint32_t word = (address & ~(sizeof(uint32_t) - 1UL));
+    const uint32_t base = (address & ~(page_size - 1UL));
+    std::lock_guard<std::recursive_mutex> lock(mutex());
+    if(hook != nullptr) {
+        const auto entry = hooks().insert({word, hook});
+        if(entry.second) {
+            hooked_pages()[base]++;
+        } else {
+            entry.first->second = hook;
+        }
+    } else if(hooks().erase(word) != 0U) {
+        if(--hooked_pages()[base] == 0UL) {
+            hooked_pages().erase(base);
+        }
+    }
+    /* Every thread maps its cached page again. */
+    generation.fetch_add(1UL, std::memory_order_release);
+}
+
+std::recursive_mutex& Register_file::mutex() {
+    static std::recursive_mutex lock;
+    return lock;
+}
+
+void Register_file::run_hook(const uint32_t& address, volatile uint32_t* reg) {
+    if(in_hook) {
+        return;
+    }
+    std::lock_guard<std::recursive_mutex> lock(mutex());
+    const auto entry = hooks().find(address & ~(sizeof(uint32_t) - 1UL));
+    if(entry != hooks().end()) {
+        in_hook = true;
+        entry->second(entry->first, *reg);
+        in_hook = false;
+    }
+}
+
+volatile uint32_t* Register_file::map_page(const uint32_t& address) {
+    const uint32_t base = address & ~(page_size - 1UL);
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex());
+        auto& page = pages()[base];
+        if(!page) {
+            page.reset(new uint32_t[words_per_page]());
+        }
+        cached_generation = generation.load(std::memory_order_relaxed);
+        cached_hooked     = (hooked_pages().count(base) != 0U);
+        cached_page       = base;
+        cached_words      = page.get();
+    }
+    volatile uint32_t* const reg = (cached_words + ((address & (page_size - 1UL)) / sizeof(uint32_t)));
+    if(cached_hooked) {
+        run_hook(address, reg);
+    }
+    return reg;
+}
+
+} /* namespace host */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
@@ -0,0 +1,173 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    stm32f10xxx_model.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Hardware behaviour of the simulated STM32F10xxx registers.
+ */
+
+/* System. */
+#include <atomic>           /* Shared with the tick thread. */
+#include <chrono>           /* Host time.                   */
+#include <mutex>            /* Register file lock.          */
+#include <thread>           /* Tick thread.                 */
+
+/* Third-party. */
+
+/* Local. */
+#include "register_file.hpp"
+#include "rcc.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  SysTick handler of the time base. The vector table and its attributes
+ *  only exist on the target.
+ */
+void systick_handler();
+
+} /* namespace stm32f10xxx */
+
+namespace host {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const uint32_t rcc_cr       = 0x4002'1000UL;    /**< RCC clock control.             */
+const uint32_t rcc_cfgr     = 0x4002'1004UL;    /**< RCC clock configuration.       */
+const uint32_t dwt_ctrl     = 0xE000'1000UL;    /**< DWT control.                   */
+const uint32_t dwt_cyccnt   = 0xE000'1004UL;    /**< DWT cycle counter.             */
+const uint32_t systick_csr  = 0xE000'E010UL;    /**< SysTick control and status.    */
+const uint32_t systick_rvr  = 0xE000'E014UL;    /**< SysTick reload value.          */
+const uint32_t systick_cvr  = 0xE000'E018UL;    /**< SysTick current value.         */
+
+std::atomic<uint64_t> tick_ns(0ULL);            /**< SysTick period, 0 when off.    */
+std::atomic<int64_t>  last_tick(0LL);           /**< Host time of the last tick.    */
+
+/**
+ *  Host time in nanoseconds.
+ *  @return Time since an arbitrary epoch.
+ */
+int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+/**
+ *  Processor cycles in a host time span, at the current HCLK.
+ *  @param[in]  ns  Time span in nanoseconds.
+ *  @return         Cycles.
+ */
+uint64_t cycles(const int64_t& ns) {
+    return ((static_cast<uint64_t>(ns) * rcc.get_clock().hclk) / 1'000'000'000ULL);
+}
+
+/**
+ *  Oscillators and the PLL are ready as soon as they are enabled.
+ */
+void rcc_cr_hook(const uint32_t&, volatile uint32_t& reg) {
+    const uint32_t on = (reg & ((1UL << 0UL) | (1UL << 16UL) | (1UL << 24UL)));
+    reg = ((reg & ~((1UL << 1UL) | (1UL << 17UL) | (1UL << 25UL))) | (on << 1UL));
+}
+
+/**
+ *  The system clock switch status follows the switch at once.
+ */
+void rcc_cfgr_hook(const uint32_t&, volatile uint32_t& reg) {
+    reg = ((reg & ~(3UL << 2UL)) | ((reg & 3UL) << 2UL));
+}
+
+/**
+ *  The cycle counter advances with host time at HCLK while enabled.
+ */
+void dwt_cyccnt_hook(const uint32_t&, volatile uint32_t& reg) {
+    static int64_t last = now_ns();
+    const int64_t now = now_ns();
+    if((Register_file::read(dwt_ctrl) & 1UL) != 0UL) {
+        reg = static_cast<uint32_t>(reg + cycles(now - last));
+    }
+    last = now;
+}
+
+/**
+ *  The current value counts down from the reload value since the last tick.
+ */
+void systick_cvr_hook(const uint32_t&, volatile uint32_t& reg) {
+    const uint64_t period = (Register_file::read(systick_rvr) & 0x00FF'FFFFUL) + 1ULL;
+    if(tick_ns == 0ULL) {
+        return;
+    }
+    const uint64_t elapsed = (cycles(now_ns() - last_tick) % period);
+    reg = static_cast<uint32_t>(period - 1ULL - elapsed);
+}
+
+/**
+ *  SysTick period while the timer and its interrupt are enabled. Called
+ *  with the register file locked.
+ *  @return Period in nanoseconds, 0 when off.
+ */
+uint64_t period_ns() {
+    const uint32_t hclk = rcc.get_clock().hclk;
+    if(((Register_file::read(systick_csr) & 3UL) != 3UL) || (hclk == 0UL)) {
+        return 0ULL;
+    }
+    return ((((Register_file::read(systick_rvr) & 0x00FF'FFFFUL) + 1ULL) * 1'000'000'000ULL) / hclk);
+}
+
+/**
+ *  Raises the SysTick exception every period, from a thread standing in
+ *  for the interrupt. It holds the register file lock while it samples the
+ *  timer and runs the handler.
+ */
+void tick_thread() {
+    uint64_t period;
+    {
+        std::lock_guard<std::recursive_mutex> lock(Register_file::mutex());
+        period = period_ns();
+    }
+    while(true) {
+        tick_ns = period;
+        std::this_thread::sleep_for(std::chrono::nanoseconds((period != 0ULL) ? period : 1'000'000ULL));
+        std::lock_guard<std::recursive_mutex> lock(Register_file::mutex());
+        const uint64_t current = period_ns();
+        if((period != 0ULL) && (current == period)) {
+            last_tick = now_ns();
+            stm32f10xxx::systick_handler();
+        }
+        period = current;
+    }
+}
+
+/**
+ *  Installs the model before main runs.
+ */
+struct Model {
+    Model() {
+        Register_file::set_hook(rcc_cr, rcc_cr_hook);
+        Register_file::set_hook(rcc_cfgr, rcc_cfgr_hook);
+        Register_file::set_hook(dwt_cyccnt, dwt_cyccnt_hook);
+        Register_file::set_hook(systick_cvr, systick_cvr_hook);
+        /* The HSI runs after reset. */
+        Register_file::write(rcc_cr, 1UL);
+        std::thread(tick_thread).detach();
+    }
+};
+
+const Model model;      /**< Model of the simulated device. */
+
+} /* namespace */
+
+} /* namespace host */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,106 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    host_test.hpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Checks of host tests against the simulated register file.
+ */
+
+#ifndef BMPP_HAL_HOST_TEST_HPP__
+#define BMPP_HAL_HOST_TEST_HPP__
+
+/* System. */
+#include <cstdint>          /* Fixed size integers. */
+#include <cstdio>           /* Failure reports.     */
+
+/* Third-party. */
+
+
+/* Local. */
+#include "register_file.hpp"    /* Simulated registers. */
+
+/**
+ *  Checks that two values are equal, reporting the values otherwise.
+ *  @param[in]  actual      Value produced.
+ *  @param[in]  expected    Value expected.
+ */
+#define BMPP_CHECK_EQUAL(actual, expected) \
+    bmpp::hal::host::test::check_equal((actual), (expected), #actual, __FILE__, __LINE__)
+
+/**
+ *  Checks that a condition holds.
+ *  @param[in]  condition   Condition.
+ */
+#define BMPP_CHECK(condition) \
+    bmpp::hal::host::test::check_equal(static_cast<bool>(condition), true, #condition, __FILE__, __LINE__)
+
+namespace bmpp {
+
+namespace hal {
+
+namespace host {
+
+namespace test {
+
+/**
+ *  Number of failed checks.
+ *  @return Reference to the counter.
+ */
+inline uint32_t& failures() {
+    static uint32_t count = 0UL;
+    return count;
+}
+
+/**
+ *  Compares a value, reporting a mismatch.
+ *  @param[in]  actual      Value produced.
+ *  @param[in]  expected    Value expected.
+ *  @param[in]  expression  Expression producing the value.
+ *  @param[in]  file        Source file of the check.
+ *  @param[in]  line        Source line of the check.
+ *  @return None.
+ */
+template<class T, class U>
+void check_equal(const T& actual, const U& expected, const char* expression, const char* file, const int& line) {
+    if(actual != static_cast<T>(expected)) {
+        std::printf("%s:%d: %s is 0x%llx, expected 0x%llx\n", file, line, expression,
+                    static_cast<unsigned long long>(actual), static_cast<unsigned long long>(static_cast<T>(expected)));
+        failures()++;
+    }
+}
+
+/**
+ *  Clears the simulated registers, keeping the hardware model.
+ *  @return None.
+ */
+inline void reset() {
+    Register_file::reset();
+    /* The HSI runs after reset. */
+    Register_file::write(0x4002'1000UL, 1UL);
+}
+
+/**
+ *  Exit status of a test, reporting the number of failures.
+ *  @return Zero when all checks passed.
+ */
+inline int result() {
+    if(failures() != 0UL) {
+        std::printf("%u check(s) failed\n", static_cast<unsigned>(failures()));
+    }
+    return (failures() == 0UL) ? 0 : 1;
+}
+
+} /* namespace test */
+
+} /* namespace host */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+#endif /* BMPP_HAL_HOST_TEST_HPP__ */
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
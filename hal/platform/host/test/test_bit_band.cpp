@@ -0,0 +1,93 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_bit_band.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Bit-band regions and alias addresses, single bit accesses.
+ */
+
+/* System. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "bit_band.hpp"
+#include "mem_access.hpp"
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+using Bit_band = bmpp::hal::cortex_m3::Bit_band_storage;
+
+namespace {
+
+const uint32_t scratch = 0x4000'0000UL;     /**< Scratch register.  */
+
+/* The aliases are computed at compile time. */
+static_assert(Bit_band::alias(0x2000'0300UL, 2UL) == 0x2200'6008UL, "Alias of an SRAM bit.");
+static_assert(Bit_band::is_bit_band(0x4002'1018UL), "RCC is in the peripheral region.");
+
+void test_region() {
+    /* SRAM and peripheral regions span 1 MiB each. */
+    BMPP_CHECK(Bit_band::is_bit_band(0x2000'0000UL));
+    BMPP_CHECK(Bit_band::is_bit_band(0x200F'FFFCUL));
+    BMPP_CHECK(!Bit_band::is_bit_band(0x2010'0000UL));
+    BMPP_CHECK(!Bit_band::is_bit_band(0x1FFF'FFFCUL));
+    BMPP_CHECK(Bit_band::is_bit_band(0x4000'0000UL));
+    BMPP_CHECK(Bit_band::is_bit_band(0x400F'FFFCUL));
+    BMPP_CHECK(!Bit_band::is_bit_band(0x4010'0000UL));
+    BMPP_CHECK(!Bit_band::is_bit_band(0x3FFF'FFFCUL));
+
+    /* Alias regions and the private peripheral bus have no aliases. */
+    BMPP_CHECK(!Bit_band::is_bit_band(0x2200'0000UL));
+    BMPP_CHECK(!Bit_band::is_bit_band(0x4200'0000UL));
+    BMPP_CHECK(!Bit_band::is_bit_band(0xE000'E100UL));
+}
+
+void test_alias() {
+    /* alias = region base + 0x0200'0000 + (offset * 32) + (bit * 4). */
+    BMPP_CHECK_EQUAL(Bit_band::alias(0x2000'0000UL, 0UL), 0x2200'0000UL);
+    BMPP_CHECK_EQUAL(Bit_band::alias(0x2000'0300UL, 2UL), 0x2200'6008UL);
+    BMPP_CHECK_EQUAL(Bit_band::alias(0x200F'FFFCUL, 31UL), 0x23FF'FFFCUL);
+    BMPP_CHECK_EQUAL(Bit_band::alias(0x4000'0000UL, 0UL), 0x4200'0000UL);
+    /* RCC APB2ENR bit 2, port A clock. */
+    BMPP_CHECK_EQUAL(Bit_band::alias(0x4002'1018UL, 2UL), 0x4242'0308UL);
+    /* GPIOA ODR bit 13. */
+    BMPP_CHECK_EQUAL(Bit_band::alias(0x4001'080CUL, 13UL), 0x4221'01B4UL);
+    /* Byte addresses within a word alias the word. */
+    BMPP_CHECK_EQUAL(Bit_band::alias(0x4001'080FUL, 13UL), 0x4221'01B4UL);
+}
+
+void test_bit() {
+    host::test::reset();
+    Register_file::write(scratch, 0xF0F0'0000UL);
+
+    /* A single bit changes, the rest of the word is left alone. */
+    const Memory_bit<Access_policy::read_write> bit(scratch, 3UL);
+    bit.set();
+    BMPP_CHECK_EQUAL(Register_file::read(scratch), 0xF0F0'0008UL);
+    BMPP_CHECK(bit.get());
+    bit = false;
+    BMPP_CHECK_EQUAL(Register_file::read(scratch), 0xF0F0'0000UL);
+    BMPP_CHECK(!bit);
+
+    const Memory_register<Access_policy::read_write> reg(scratch);
+    const Memory_bit<Access_policy::read_write> top(reg, 31UL);
+    BMPP_CHECK(top.get());
+    top.clear();
+    BMPP_CHECK_EQUAL(Register_file::read(scratch), 0x70F0'0000UL);
+}
+
+} /* namespace */
+
+int main() {
+    test_region();
+    test_alias();
+    test_bit();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
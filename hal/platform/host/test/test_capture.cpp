@@ -0,0 +1,247 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_capture.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Streams, triggers and sample order of the capture driver.
+ */
+
+/* System. */
+#include <array>            /* Buffers. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "gpio.hpp"
+#include "timer.hpp"
+#include "capture.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  DMA1 channel 2 handler of the driver, outside the vector table.
+ */
+void dma1_channel2_handler();
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+using Capture = bmpp::hal::stm32f10xxx::Capture;
+
+namespace {
+
+const uint32_t tim2_cr1 = 0x4000'0000UL;    /**< TIM2 control 1.                */
+const uint32_t tim2_dier = 0x4000'000CUL;   /**< TIM2 DMA/interrupt enable.     */
+const uint32_t dma_isr = 0x4002'0000UL;     /**< Interrupt status.              */
+const uint32_t ccr2 = 0x4002'001CUL;        /**< Channel 2 configuration.       */
+const uint32_t cndtr2 = 0x4002'0020UL;      /**< Channel 2 number of data.      */
+const uint32_t cpar2 = 0x4002'0024UL;       /**< Channel 2 peripheral address.  */
+const uint32_t gpioa_idr = 0x4001'0808UL;   /**< Port A input data.             */
+
+const uint32_t cen = (1UL << 0UL);          /**< CR1 counter enable.            */
+const uint32_t gif2 = (1UL << 4UL);         /**< Channel 2 any event.           */
+const uint32_t tcif2 = (1UL << 5UL);        /**< Channel 2 complete.            */
+const uint32_t htif2 = (1UL << 6UL);        /**< Channel 2 half transfer.       */
+const uint32_t teif2 = (1UL << 7UL);        /**< Channel 2 transfer error.      */
+
+constexpr Capture capture(tim2);            /**< Capture paced by TIM2.         */
+
+const uint16_t* block_samples;              /**< Last streamed half.            */
+uint16_t block_count;                       /**< Samples of the last half.      */
+uint32_t block_calls;                       /**< Number of streamed halves.     */
+uint32_t done_calls;                        /**< Number of ended captures.      */
+
+void on_block(const uint16_t* samples, const uint16_t& count) {
+    block_samples = samples;
+    block_count = count;
+    block_calls++;
+}
+
+void on_done() {
+    done_calls++;
+}
+
+/**
+ *  Raises the DMA interrupt of the update channel, with the number of
+ *  samples still to be written before the buffer wraps.
+ *  @param[in]  flags       Channel 2 flags of the interrupt status.
+ *  @param[in]  remaining   Number of data of the channel.
+ *  @return None.
+ */
+void dma_event(const uint32_t& flags, const uint32_t& remaining) {
+    Register_file::write(cndtr2, remaining);
+    Register_file::write(dma_isr, flags | gif2);
+    stm32f10xxx::dma1_channel2_handler();
+    Register_file::write(dma_isr, 0UL);
+}
+
+void test_refused() {
+    host::test::reset();
+    std::array<uint16_t, 8> samples = {};
+    const Capture::Trigger trigger = { 0x0001U, 0x0001U, true };
+
+    BMPP_CHECK(!capture.stream(gpio_a, samples.data(), 0U, 1000UL, on_block));
+    BMPP_CHECK(!capture.stream(gpio_a, samples.data(), 7U, 1000UL, on_block));
+    BMPP_CHECK(!capture.arm(gpio_a, samples.data(), 0U, 1000UL, trigger, 2U, on_done));
+    BMPP_CHECK(!capture.arm(gpio_a, samples.data(), 7U, 1000UL, trigger, 2U, on_done));
+    BMPP_CHECK(!capture.stream(gpio_a, samples, 8'000'000UL, on_block));
+    BMPP_CHECK(!capture.is_running());
+    BMPP_CHECK_EQUAL(Register_file::read(ccr2) & 1UL, 0UL);
+
+    /* A refused count leaves a running capture alone. */
+    BMPP_CHECK(capture.stream(gpio_a, samples, 1000UL, on_block));
+    BMPP_CHECK(!capture.arm(gpio_a, samples.data(), 5U, 1000UL, trigger, 2U, on_done));
+    BMPP_CHECK(capture.is_running());
+    BMPP_CHECK_EQUAL(Register_file::read(ccr2) & 1UL, 1UL);
+    capture.stop();
+}
+
+void test_stream() {
+    host::test::reset();
+    std::array<uint16_t, 8> samples = { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U };
+    block_calls = 0UL;
+
+    BMPP_CHECK(capture.stream(gpio_a, samples, 1000UL, on_block));
+    BMPP_CHECK(capture.is_running());
+    BMPP_CHECK_EQUAL(Register_file::read(cpar2), gpioa_idr);
+    BMPP_CHECK_EQUAL(Register_file::read(cndtr2), 8UL);
+    BMPP_CHECK_EQUAL(Register_file::read(ccr2) & (1UL << 5UL), (1UL << 5UL));
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_cr1) & cen, cen);
+
+    dma_event(htif2, 4UL);
+    BMPP_CHECK_EQUAL(block_calls, 1UL);
+    BMPP_CHECK(block_samples == samples.data());
+    BMPP_CHECK_EQUAL(block_count, 4U);
+    dma_event(tcif2, 8UL);
+    BMPP_CHECK_EQUAL(block_calls, 2UL);
+    BMPP_CHECK(block_samples == (samples.data() + 4U));
+
+    /* Two samples into the next pass, the oldest sample is the third. */
+    Register_file::write(cndtr2, 6UL);
+    capture.stop();
+    BMPP_CHECK(!capture.is_running());
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_cr1) & cen, 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_dier), 0UL);
+    BMPP_CHECK_EQUAL(capture.get_size(), 8U);
+    BMPP_CHECK_EQUAL(capture.get_sample(0U), 2U);
+    BMPP_CHECK_EQUAL(capture.get_sample(5U), 7U);
+    BMPP_CHECK_EQUAL(capture.get_sample(7U), 1U);
+}
+
+void test_trigger() {
+    host::test::reset();
+    std::array<uint16_t, 8> samples = {};
+    const Capture::Trigger trigger = { 0x0001U, 0x0001U, true };
+    done_calls = 0UL;
+
+    /* Two pre-trigger samples and a half leave two samples to follow. */
+    BMPP_CHECK(capture.arm(gpio_a, samples, 1000UL, trigger, 2U, on_done));
+    BMPP_CHECK(!capture.is_triggered());
+
+    /* A condition present when armed is not an edge. */
+    samples = { 0x11U, 0x11U, 0x10U, 0x10U, 0U, 0U, 0U, 0U };
+    dma_event(htif2, 4UL);
+    BMPP_CHECK(!capture.is_triggered());
+    BMPP_CHECK(capture.is_running());
+
+    /* The edge at position 5 is followed by enough samples at the wrap,
+       one more sample is taken during the interrupt latency. */
+    samples[4] = 0x20U;
+    samples[5] = 0x21U;
+    samples[6] = 0x23U;
+    samples[7] = 0x22U;
+    dma_event(tcif2, 7UL);
+    samples[0] = 0x24U;
+    BMPP_CHECK(capture.is_triggered());
+    BMPP_CHECK(!capture.is_running());
+    BMPP_CHECK_EQUAL(done_calls, 1UL);
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_cr1) & cen, 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(ccr2) & 1UL, 0UL);
+
+    BMPP_CHECK_EQUAL(capture.get_size(), 8U);
+    BMPP_CHECK_EQUAL(capture.get_trigger_index(), 4U);
+    BMPP_CHECK_EQUAL(capture.get_sample(capture.get_trigger_index()), 0x21U);
+    BMPP_CHECK_EQUAL(capture.get_sample(0U), 0x11U);
+    BMPP_CHECK_EQUAL(capture.get_sample(3U), 0x20U);
+    BMPP_CHECK_EQUAL(capture.get_sample(7U), 0x24U);
+}
+
+void test_immediate() {
+    host::test::reset();
+    std::array<uint16_t, 8> samples = { 7U, 6U, 5U, 4U, 3U, 2U, 1U, 0U };
+    const Capture::Trigger trigger = { 0x0000U, 0x0001U, true };
+    done_calls = 0UL;
+
+    /* Without pins to compare the first sample triggers, and the capture
+       stops after a half without pre-trigger samples. */
+    BMPP_CHECK(capture.arm(gpio_a, samples, 1000UL, trigger, 0U, nullptr));
+    dma_event(htif2, 4UL);
+    BMPP_CHECK(capture.is_triggered());
+    BMPP_CHECK(!capture.is_running());
+    BMPP_CHECK_EQUAL(done_calls, 0UL);
+    BMPP_CHECK_EQUAL(capture.get_size(), 4U);
+    BMPP_CHECK_EQUAL(capture.get_trigger_index(), 0U);
+    BMPP_CHECK_EQUAL(capture.get_sample(0U), 7U);
+    BMPP_CHECK_EQUAL(capture.get_sample(3U), 4U);
+}
+
+void test_late() {
+    host::test::reset();
+    std::array<uint16_t, 8> samples = { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U };
+    const Capture::Trigger trigger = { 0x0000U, 0x0000U, false };
+    done_calls = 0UL;
+
+    /* Both halves are served in one interrupt, the capture ends with the
+       first and ignores the second. */
+    BMPP_CHECK(capture.arm(gpio_a, samples, 1000UL, trigger, 0U, on_done));
+    dma_event(htif2 | tcif2, 7UL);
+    BMPP_CHECK(!capture.is_running());
+    BMPP_CHECK_EQUAL(done_calls, 1UL);
+    BMPP_CHECK_EQUAL(capture.get_size(), 8U);
+    BMPP_CHECK_EQUAL(capture.get_sample(0U), 1U);
+    BMPP_CHECK_EQUAL(capture.get_sample(7U), 0U);
+}
+
+void test_error() {
+    host::test::reset();
+    std::array<uint16_t, 8> samples = {};
+    const Capture::Trigger trigger = { 0x0001U, 0x0001U, false };
+    done_calls = 0UL;
+
+    /* A bus error ends the capture untriggered, without calling done. */
+    BMPP_CHECK(capture.arm(gpio_a, samples, 1000UL, trigger, 2U, on_done));
+    Register_file::write(ccr2, Register_file::read(ccr2) & ~1UL);
+    dma_event(teif2, 5UL);
+    BMPP_CHECK(!capture.is_running());
+    BMPP_CHECK(!capture.is_triggered());
+    BMPP_CHECK_EQUAL(done_calls, 0UL);
+    BMPP_CHECK_EQUAL(capture.get_size(), 3U);
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_cr1) & cen, 0UL);
+}
+
+} /* namespace */
+
+int main() {
+    test_refused();
+    test_stream();
+    test_trigger();
+    test_immediate();
+    test_late();
+    test_error();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
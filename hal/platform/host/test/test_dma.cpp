@@ -0,0 +1,194 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_dma.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Transfers, busy state and events of the DMA driver.
+ */
+
+/* System. */
+#include <array>            /* Buffers. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "dma.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  DMA1 channel 3 handler of the driver, outside the vector table.
+ */
+void dma1_channel3_handler();
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+using Dma_channel = bmpp::hal::stm32f10xxx::Dma_channel;
+
+namespace {
+
+const uint32_t dma_isr = 0x4002'0000UL;     /**< Interrupt status.              */
+const uint32_t dma_ifcr = 0x4002'0004UL;    /**< Interrupt flag clear.          */
+const uint32_t ccr3 = 0x4002'0030UL;        /**< Channel 3 configuration.       */
+const uint32_t cndtr3 = 0x4002'0034UL;      /**< Channel 3 number of data.      */
+const uint32_t cpar3 = 0x4002'0038UL;       /**< Channel 3 peripheral address.  */
+const uint32_t nvic_iser0 = 0xE000'E100UL;  /**< Interrupt set-enable.          */
+const uint32_t peripheral = 0x4001'380CUL;  /**< USART1 data register.          */
+
+const uint32_t tcif3 = (1UL << 9UL);        /**< Channel 3 complete.            */
+const uint32_t htif3 = (1UL << 10UL);       /**< Channel 3 half transfer.       */
+const uint32_t teif3 = (1UL << 11UL);       /**< Channel 3 transfer error.      */
+
+std::array<Dma_channel::Event, 4> events;   /**< Reported events.   */
+uint32_t event_count;                       /**< Number of events.  */
+void* event_context;                        /**< Context reported.  */
+
+void on_event(void* context, const Dma_channel::Event& event) {
+    event_context = context;
+    if(event_count < events.size()) {
+        events[event_count] = event;
+    }
+    event_count++;
+}
+
+/**
+ *  Ends the running transfer as the DMA would, by counting down to zero.
+ *  @return None.
+ */
+void complete() {
+    Register_file::write(cndtr3, 0UL);
+}
+
+void test_busy() {
+    host::test::reset();
+    std::array<uint8_t, 8> buffer = {};
+    std::array<uint8_t, 8> other = {};
+    dma1_channel3.set_callback(nullptr);
+
+    BMPP_CHECK(dma1_channel3.receive(peripheral, buffer));
+    BMPP_CHECK_EQUAL(Register_file::read(cndtr3), 8UL);
+    BMPP_CHECK_EQUAL(Register_file::read(cpar3), peripheral);
+    BMPP_CHECK(dma1_channel3.is_busy());
+
+    /* A busy channel keeps its transfer. */
+    BMPP_CHECK(!dma1_channel3.transmit(other, peripheral));
+    BMPP_CHECK_EQUAL(Register_file::read(cndtr3), 8UL);
+    BMPP_CHECK_EQUAL(Register_file::read(ccr3) & (1UL << 4UL), 0UL);
+
+    complete();
+    BMPP_CHECK(!dma1_channel3.is_busy());
+    BMPP_CHECK(dma1_channel3.wait());
+    BMPP_CHECK(dma1_channel3.transmit(other, peripheral));
+    BMPP_CHECK_EQUAL(Register_file::read(ccr3) & (1UL << 4UL), (1UL << 4UL));
+
+    /* Circular transfers stay busy until stopped. */
+    BMPP_CHECK(dma1_channel3.stop() == 8U);
+    BMPP_CHECK(dma1_channel3.receive(peripheral, buffer, Dma_channel::Mode::circular));
+    complete();
+    BMPP_CHECK(dma1_channel3.is_busy());
+    BMPP_CHECK(!dma1_channel3.copy(buffer.data(), other.data(), 8U));
+    Register_file::write(cndtr3, 3UL);
+    BMPP_CHECK_EQUAL(dma1_channel3.stop(), 3U);
+    BMPP_CHECK_EQUAL(Register_file::read(ccr3) & 1UL, 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(dma_ifcr), 0x0000'0F00UL);
+    BMPP_CHECK(!dma1_channel3.is_busy());
+}
+
+void test_events() {
+    host::test::reset();
+    std::array<uint16_t, 8> buffer = {};
+    int context = 0;
+    event_count = 0UL;
+    dma1_channel3.set_callback(on_event, &context, true);
+    BMPP_CHECK(dma1_channel3.receive(peripheral, buffer, Dma_channel::Mode::circular));
+    /* Complete, half transfer and error interrupts, 16 bit elements. */
+    BMPP_CHECK_EQUAL(Register_file::read(ccr3), 0x05AFUL);
+    BMPP_CHECK_EQUAL(Register_file::read(nvic_iser0), (1UL << 13UL));
+
+    /* Flags are cleared before the callback, half before complete. */
+    Register_file::write(dma_isr, tcif3 | htif3 | (1UL << 8UL));
+    stm32f10xxx::dma1_channel3_handler();
+    BMPP_CHECK_EQUAL(Register_file::read(dma_ifcr), tcif3 | htif3 | (1UL << 8UL));
+    BMPP_CHECK_EQUAL(event_count, 2UL);
+    BMPP_CHECK(events[0] == Dma_channel::Event::half);
+    BMPP_CHECK(events[1] == Dma_channel::Event::complete);
+    BMPP_CHECK(event_context == &context);
+    BMPP_CHECK(!dma1_channel3.has_error());
+    dma1_channel3.stop();
+}
+
+void test_without_half() {
+    host::test::reset();
+    std::array<uint8_t, 8> buffer = {};
+    int context = 0;
+    event_count = 0UL;
+    dma1_channel3.set_callback(on_event, &context, false);
+    BMPP_CHECK(dma1_channel3.receive(peripheral, buffer, Dma_channel::Mode::circular));
+    BMPP_CHECK_EQUAL(Register_file::read(ccr3) & (1UL << 2UL), 0UL);
+
+    /* The half transfer flag is set regardless, but not reported. */
+    Register_file::write(dma_isr, tcif3 | htif3 | (1UL << 8UL));
+    stm32f10xxx::dma1_channel3_handler();
+    BMPP_CHECK_EQUAL(Register_file::read(dma_ifcr), tcif3 | htif3 | (1UL << 8UL));
+    BMPP_CHECK_EQUAL(event_count, 1UL);
+    BMPP_CHECK(events[0] == Dma_channel::Event::complete);
+
+    Register_file::write(dma_isr, htif3 | (1UL << 8UL));
+    stm32f10xxx::dma1_channel3_handler();
+    BMPP_CHECK_EQUAL(event_count, 1UL);
+    dma1_channel3.stop();
+}
+
+void test_error() {
+    host::test::reset();
+    std::array<uint8_t, 4> buffer = {};
+    event_count = 0UL;
+    dma1_channel3.set_callback(on_event);
+    BMPP_CHECK(dma1_channel3.transmit(buffer, peripheral));
+    BMPP_CHECK_EQUAL(Register_file::read(ccr3) & (1UL << 2UL), 0UL);
+
+    /* A bus error disables the channel, the error outlives its flag. */
+    Register_file::write(ccr3, Register_file::read(ccr3) & ~1UL);
+    Register_file::write(dma_isr, teif3 | (1UL << 8UL));
+    stm32f10xxx::dma1_channel3_handler();
+    Register_file::write(dma_isr, 0UL);
+    BMPP_CHECK_EQUAL(event_count, 1UL);
+    BMPP_CHECK(events[0] == Dma_channel::Event::error);
+    BMPP_CHECK(!dma1_channel3.is_busy());
+    BMPP_CHECK(dma1_channel3.has_error());
+    BMPP_CHECK(!dma1_channel3.wait());
+
+    /* Without a callback the flag itself reports the error. */
+    dma1_channel3.set_callback(nullptr);
+    BMPP_CHECK(dma1_channel3.transmit(buffer, peripheral));
+    BMPP_CHECK(!dma1_channel3.has_error());
+    Register_file::write(dma_isr, teif3);
+    BMPP_CHECK(dma1_channel3.has_error());
+    dma1_channel3.stop();
+}
+
+} /* namespace */
+
+int main() {
+    test_busy();
+    test_events();
+    test_without_half();
+    test_error();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
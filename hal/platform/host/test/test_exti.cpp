@@ -0,0 +1,97 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_exti.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Line selection and interrupt dispatch of the EXTI driver.
+ */
+
+/* System. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "exti.hpp"
+#include "gpio.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  EXTI lines 5 to 9 handler of the driver, outside the vector table.
+ */
+void exti9_5_handler();
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+
+namespace {
+
+const uint32_t exti_imr = 0x4001'0400UL;    /**< Interrupt mask.            */
+const uint32_t exti_rtsr = 0x4001'0408UL;   /**< Rising trigger selection.  */
+const uint32_t exti_ftsr = 0x4001'040CUL;   /**< Falling trigger selection. */
+const uint32_t exti_pr = 0x4001'0414UL;     /**< Pending.                   */
+const uint32_t afio_exticr2 = 0x4001'000CUL;/**< Port selection, lines 4-7. */
+const uint32_t nvic_iser0 = 0xE000'E100UL;  /**< Interrupt set-enable.      */
+
+uint32_t calls;         /**< Callback invocations.  */
+uint32_t lines;         /**< Lines reported.        */
+
+void on_edge(const uint8_t& line) {
+    calls++;
+    lines |= (1UL << line);
+}
+
+void test_select() {
+    host::test::reset();
+    exti.enable_interrupt(1U, 5U, stm32f10xxx::Exti::Edge::rising, on_edge);
+    exti.enable_interrupt<Static_pin<2U, 7U>>(stm32f10xxx::Exti::Edge::both, on_edge);
+    BMPP_CHECK_EQUAL(Register_file::read(afio_exticr2), 0x2010UL);
+    BMPP_CHECK_EQUAL(Register_file::read(exti_imr), 0x00A0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(exti_rtsr), 0x00A0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(exti_ftsr), 0x0080UL);
+    /* Lines 5 to 9 share an interrupt. */
+    BMPP_CHECK_EQUAL(Register_file::read(nvic_iser0), (1UL << 23UL));
+}
+
+void test_dispatch() {
+    calls = 0UL;
+    lines = 0UL;
+    /* Line 6 is pending but masked, line 2 belongs to another group. */
+    Register_file::write(exti_pr, 0x00E4UL);
+    stm32f10xxx::exti9_5_handler();
+    BMPP_CHECK_EQUAL(calls, 2UL);
+    BMPP_CHECK_EQUAL(lines, 0x00A0UL);
+    /* Only the served lines are cleared, by writing ones. */
+    BMPP_CHECK_EQUAL(Register_file::read(exti_pr), 0x00A0UL);
+
+    exti.disable(5U);
+    BMPP_CHECK_EQUAL(Register_file::read(exti_imr), 0x0080UL);
+    calls = 0UL;
+    Register_file::write(exti_pr, 0x00A0UL);
+    stm32f10xxx::exti9_5_handler();
+    BMPP_CHECK_EQUAL(calls, 1UL);
+}
+
+} /* namespace */
+
+int main() {
+    test_select();
+    test_dispatch();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,78 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_gpio.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Pin configuration and output registers of the GPIO driver.
+ */
+
+/* System. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "gpio.hpp"
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+
+namespace {
+
+const uint32_t port_a = 0x4001'0800UL;      /**< Port A registers. */
+const uint32_t crl = 0x00UL;
+const uint32_t crh = 0x04UL;
+const uint32_t odr = 0x0CUL;
+const uint32_t bsrr = 0x10UL;
+const uint32_t brr = 0x14UL;
+
+/**
+ *  Reset state of the configuration registers, all pins floating inputs.
+ *  @return None.
+ */
+void reset_ports() {
+    host::test::reset();
+    Register_file::write(port_a + crl, 0x4444'4444UL);
+    Register_file::write(port_a + crh, 0x4444'4444UL);
+}
+
+void test_config() {
+    reset_ports();
+    gpio_a.config_pin(5U, Pin::Config::output_pushpull);
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + crl), 0x4424'4444UL);
+    gpio_a.config_pin(12U, Pin::Config::alternate_opendrain);
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + crh), 0x444F'4444UL);
+}
+
+void test_outputs() {
+    reset_ports();
+    gpio_a.set_pins(0x0021UL);
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + bsrr), 0x0000'0021UL);
+    gpio_a.clear_pins(0x0021UL);
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + brr), 0x0000'0021UL);
+    gpio_a.write_pins(0x0001UL, 0x0002UL);
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + bsrr), 0x0002'0001UL);
+    Register_file::write(port_a + odr, 0x0001UL);
+    gpio_a.toggle_pins(0x0003UL);
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + bsrr), 0x0001'0002UL);
+    gpio_a.set_pin_state(7U, Pin::State::low);
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + brr), 0x0000'0080UL);
+
+    /* A single pin toggles through the same single store. */
+    Register_file::write(port_a + odr, 0x0100UL);
+    gpio_a[8U].toggle();
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + bsrr), 0x0100'0000UL);
+}
+
+} /* namespace */
+
+int main() {
+    test_config();
+    test_outputs();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,444 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_i2c.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Request queue of the I2C driver.
+ */
+
+/* System. */
+#include <array>            /* Bus data. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "i2c.hpp"
+#include "dwt.hpp"
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+using I2c = bmpp::hal::stm32f10xxx::I2c;
+
+namespace {
+
+const uint32_t i2c1_cr1   = 0x4000'5400UL;  /**< I2C1 control 1.    */
+const uint32_t i2c1_cr2   = 0x4000'5404UL;  /**< I2C1 control 2.    */
+const uint32_t i2c1_dr    = 0x4000'5410UL;  /**< I2C1 data.         */
+const uint32_t i2c1_sr1   = 0x4000'5414UL;  /**< I2C1 status 1.     */
+const uint32_t i2c1_sr2   = 0x4000'5418UL;  /**< I2C1 status 2.     */
+const uint32_t i2c1_ccr   = 0x4000'541CUL;  /**< I2C1 clock.        */
+const uint32_t i2c1_trise = 0x4000'5420UL;  /**< I2C1 rise time.    */
+const uint32_t gpiob_crl  = 0x4001'0C00UL;  /**< Port B pins 0-7.   */
+const uint32_t gpiob_idr  = 0x4001'0C08UL;  /**< Port B input.      */
+const uint32_t gpiob_bsrr = 0x4001'0C10UL;  /**< Port B bit set.    */
+const uint32_t gpiob_brr  = 0x4001'0C14UL;  /**< Port B bit reset.  */
+
+const uint32_t pe      = (1UL << 0UL);      /**< CR1 enable.        */
+const uint32_t start   = (1UL << 8UL);      /**< CR1 start.         */
+const uint32_t stop    = (1UL << 9UL);      /**< CR1 stop.          */
+const uint32_t ack     = (1UL << 10UL);     /**< CR1 acknowledge.   */
+const uint32_t pos     = (1UL << 11UL);     /**< CR1 next byte.     */
+const uint32_t itbufen = (1UL << 10UL);     /**< CR2 buffer events. */
+const uint32_t sb      = (1UL << 0UL);      /**< SR1 start sent.    */
+const uint32_t addr    = (1UL << 1UL);      /**< SR1 address sent.  */
+const uint32_t btf     = (1UL << 2UL);      /**< SR1 byte done.     */
+const uint32_t rxne    = (1UL << 6UL);      /**< SR1 byte received. */
+const uint32_t berr    = (1UL << 8UL);      /**< SR1 bus error.     */
+const uint32_t arlo    = (1UL << 9UL);      /**< SR1 lost the bus.  */
+const uint32_t af      = (1UL << 10UL);     /**< SR1 no ACK.        */
+const uint32_t busy    = (1UL << 1UL);      /**< SR2 bus busy.      */
+const uint32_t sda_pin = (1UL << 7UL);      /**< PB7 data.          */
+
+std::array<uint8_t, 4> bus_data;            /**< Bytes sent by the device.          */
+std::array<uint32_t, 4> cr1_at_read;        /**< CR1 when each byte was read.       */
+uint32_t data_read;                         /**< Bytes read from DR.                */
+bool feeding;                               /**< DR reads return device bytes.      */
+uint32_t cr1_at_addr;                       /**< CR1 when ADDR was last cleared.    */
+uint32_t clock_pulses;                      /**< SCL driven low by hand.            */
+
+uint32_t stop_accesses;                     /**< CR1 accesses until the stop ends. */
+I2c::Request* chained;                      /**< Submitted from a callback.         */
+bool chained_submitted;                     /**< Result of the submit.              */
+
+/**
+ *  Ends a generated stop condition after a number of CR1 accesses.
+ *  @param[in]  address Address of CR1.
+ *  @param[in]  reg     CR1.
+ *  @return None.
+ */
+void cr1_hook(const uint32_t&, volatile uint32_t& reg) {
+    if((stop_accesses > 0UL) && (--stop_accesses == 0UL)) {
+        reg = (reg & ~stop);
+    }
+}
+
+/**
+ *  Hands the bytes of the device to DR reads, recording CR1 at each read.
+ *  @param[in]  address Address of DR.
+ *  @param[in]  reg     DR.
+ *  @return None.
+ */
+void dr_hook(const uint32_t&, volatile uint32_t& reg) {
+    if(feeding && (data_read < bus_data.size())) {
+        cr1_at_read[data_read] = Register_file::read(i2c1_cr1);
+        reg = bus_data[data_read++];
+    }
+}
+
+/**
+ *  Records CR1 at reads of SR2, which clear ADDR.
+ *  @param[in]  address Address of SR2.
+ *  @param[in]  reg     SR2.
+ *  @return None.
+ */
+void sr2_hook(const uint32_t&, volatile uint32_t&) {
+    cr1_at_addr = Register_file::read(i2c1_cr1);
+}
+
+/**
+ *  Releases SDA held by a device, and the bus, after three clock pulses.
+ *  @param[in]  address Address of BRR.
+ *  @param[in]  reg     BRR.
+ *  @return None.
+ */
+void brr_hook(const uint32_t&, volatile uint32_t&) {
+    if(++clock_pulses == 3UL) {
+        Register_file::write(gpiob_idr, sda_pin);
+        Register_file::write(i2c1_sr2, 0UL);
+    }
+}
+
+/**
+ *  Starts handing device bytes to DR reads.
+ *  @param[in]  bytes   Bytes sent by the device.
+ *  @return None.
+ */
+void feed(const std::array<uint8_t, 4>& bytes) {
+    bus_data = bytes;
+    data_read = 0UL;
+    feeding = true;
+}
+
+/**
+ *  Prepares the port and the hooks of a test.
+ *  @return None.
+ */
+void setup() {
+    host::test::reset();
+    dwt.enable();
+    feeding = false;
+    BMPP_CHECK(i2c1.initialize(100'000UL));
+    Register_file::set_hook(i2c1_dr, dr_hook);
+    Register_file::set_hook(i2c1_sr2, sr2_hook);
+}
+
+/**
+ *  Removes the hooks of a test.
+ *  @return None.
+ */
+void teardown() {
+    Register_file::set_hook(i2c1_dr, nullptr);
+    Register_file::set_hook(i2c1_sr2, nullptr);
+    feeding = false;
+}
+
+void submit_chained(I2c::Request&) {
+    /* The stop condition just requested is still being generated. */
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & stop, stop);
+    stop_accesses = 3UL;
+    chained_submitted = i2c1.submit(*chained);
+}
+
+/**
+ *  Raises the event interrupt with the given status, after the peripheral
+ *  cleared the start or stop condition it generated.
+ *  @param[in]  sr1         Status register 1.
+ *  @param[in]  generated   CR1 bits cleared by the peripheral.
+ *  @return None.
+ */
+void event(const uint32_t& sr1, const uint32_t& generated = 0UL) {
+    Register_file::write(i2c1_cr1, Register_file::read(i2c1_cr1) & ~generated);
+    Register_file::write(i2c1_sr1, sr1);
+    i2c1.handle_event();
+}
+
+/**
+ *  Writes one byte to a device, as seen by the event interrupt.
+ *  @param[in]  address 7 bit device address.
+ *  @return None.
+ */
+void write_byte(const uint8_t& address) {
+    event(sb, start);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_dr), static_cast<uint32_t>(address) << 1UL);
+    event(addr);
+    event(btf);
+}
+
+void test_queue() {
+    host::test::reset();
+    dwt.enable();
+    BMPP_CHECK(i2c1.initialize(100'000UL));
+
+    const uint8_t first_byte = 0x12U;
+    const uint8_t second_byte = 0x34U;
+    I2c::Request first = {0x50U, &first_byte, 1U, nullptr, 0U, nullptr, I2c::Status::idle, nullptr};
+    I2c::Request second = {0x51U, &second_byte, 1U, nullptr, 0U, nullptr, I2c::Status::idle, nullptr};
+
+    /* A stop condition still generated holds the start back. */
+    Register_file::write(i2c1_cr1, Register_file::read(i2c1_cr1) | stop);
+    BMPP_CHECK(i2c1.submit(first));
+    BMPP_CHECK(i2c1.submit(second));
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & start, 0UL);
+
+    /* Thread context starts the queue once the stop condition is sent. */
+    Register_file::write(i2c1_cr1, Register_file::read(i2c1_cr1) & ~stop);
+    BMPP_CHECK(i2c1.is_busy());
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & start, start);
+
+    /* The queued request follows with a repeated start. */
+    write_byte(0x50U);
+    BMPP_CHECK(first.status == I2c::Status::done);
+    BMPP_CHECK(second.status == I2c::Status::pending);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & (start | stop), start);
+
+    /* The last request ends the queue with a stop condition. */
+    write_byte(0x51U);
+    BMPP_CHECK(second.status == I2c::Status::done);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & (start | stop), stop);
+    Register_file::write(i2c1_cr1, Register_file::read(i2c1_cr1) & ~stop);
+    BMPP_CHECK(!i2c1.is_busy());
+}
+
+void test_callback() {
+    host::test::reset();
+    dwt.enable();
+    BMPP_CHECK(i2c1.initialize(100'000UL));
+    Register_file::set_hook(i2c1_cr1, cr1_hook);
+
+    const uint8_t first_byte = 0x12U;
+    const uint8_t second_byte = 0x34U;
+    I2c::Request first = {0x50U, &first_byte, 1U, nullptr, 0U, submit_chained, I2c::Status::idle, nullptr};
+    I2c::Request second = {0x51U, &second_byte, 1U, nullptr, 0U, nullptr, I2c::Status::idle, nullptr};
+    chained = &second;
+    chained_submitted = false;
+
+    /* A request submitted from the done callback starts once the stop
+       condition of the previous one ends, without thread context. */
+    BMPP_CHECK(i2c1.submit(first));
+    write_byte(0x50U);
+    BMPP_CHECK(first.status == I2c::Status::done);
+    BMPP_CHECK(chained_submitted);
+    BMPP_CHECK(second.status == I2c::Status::pending);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & (start | stop), start);
+
+    write_byte(0x51U);
+    BMPP_CHECK(second.status == I2c::Status::done);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & (start | stop), stop);
+    Register_file::set_hook(i2c1_cr1, nullptr);
+    Register_file::write(i2c1_cr1, Register_file::read(i2c1_cr1) & ~stop);
+    BMPP_CHECK(!i2c1.is_busy());
+}
+
+void test_read() {
+    setup();
+    std::array<uint8_t, 4> rx = {};
+    I2c::Request one = {0x40U, nullptr, 0U, rx.data(), 1U, nullptr, I2c::Status::idle, nullptr};
+    I2c::Request two = {0x41U, nullptr, 0U, rx.data(), 2U, nullptr, I2c::Status::idle, nullptr};
+    I2c::Request four = {0x42U, nullptr, 0U, rx.data(), 4U, nullptr, I2c::Status::idle, nullptr};
+
+    /* One byte: NACK and stop are set around clearing ADDR. */
+    BMPP_CHECK(i2c1.submit(one));
+    event(sb, start);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_dr), 0x81UL);
+    feed({0xA1U, 0U, 0U, 0U});
+    event(addr);
+    BMPP_CHECK_EQUAL(cr1_at_addr & (ack | stop), 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & (ack | stop), stop);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr2) & itbufen, itbufen);
+    event(rxne);
+    BMPP_CHECK(one.status == I2c::Status::done);
+    BMPP_CHECK_EQUAL(rx[0], 0xA1U);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr2) & itbufen, 0UL);
+    Register_file::write(i2c1_cr1, Register_file::read(i2c1_cr1) & ~stop);
+    feeding = false;
+
+    /* Two bytes: NACK the second with POS, both read on BTF after the stop. */
+    BMPP_CHECK(i2c1.submit(two));
+    event(sb, start);
+    feed({0xB1U, 0xB2U, 0U, 0U});
+    event(addr);
+    BMPP_CHECK_EQUAL(cr1_at_addr & (ack | pos | stop), pos);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr2) & itbufen, 0UL);
+    event(rxne | btf);
+    BMPP_CHECK(two.status == I2c::Status::done);
+    BMPP_CHECK_EQUAL(data_read, 2UL);
+    BMPP_CHECK_EQUAL(cr1_at_read[0] & stop, stop);
+    BMPP_CHECK_EQUAL(rx[0], 0xB1U);
+    BMPP_CHECK_EQUAL(rx[1], 0xB2U);
+    Register_file::write(i2c1_cr1, Register_file::read(i2c1_cr1) & ~stop);
+    feeding = false;
+
+    /* More bytes: the third to last is read with NACK set on BTF, the
+       second to last after the stop is requested. */
+    BMPP_CHECK(i2c1.submit(four));
+    event(sb, start);
+    feed({0xC1U, 0xC2U, 0xC3U, 0xC4U});
+    event(addr);
+    BMPP_CHECK_EQUAL(cr1_at_addr & (ack | pos), ack);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr2) & itbufen, itbufen);
+    event(rxne);
+    BMPP_CHECK_EQUAL(cr1_at_read[0] & ack, ack);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr2) & itbufen, 0UL);
+    /* RXNE alone is left to BTF, so the NACK is in time. */
+    event(rxne);
+    BMPP_CHECK_EQUAL(data_read, 1UL);
+    event(rxne | btf);
+    BMPP_CHECK_EQUAL(cr1_at_read[1] & (ack | stop), 0UL);
+    BMPP_CHECK_EQUAL(cr1_at_read[2] & (ack | stop), stop);
+    BMPP_CHECK(four.status == I2c::Status::pending);
+    event(rxne);
+    BMPP_CHECK(four.status == I2c::Status::done);
+    BMPP_CHECK_EQUAL(rx[0], 0xC1U);
+    BMPP_CHECK_EQUAL(rx[1], 0xC2U);
+    BMPP_CHECK_EQUAL(rx[2], 0xC3U);
+    BMPP_CHECK_EQUAL(rx[3], 0xC4U);
+    Register_file::write(i2c1_cr1, Register_file::read(i2c1_cr1) & ~stop);
+    BMPP_CHECK(!i2c1.is_busy());
+    teardown();
+}
+
+void test_write_read() {
+    setup();
+    const uint8_t reg = 0x10U;
+    std::array<uint8_t, 2> rx = {};
+    I2c::Request request = {0x50U, &reg, 1U, rx.data(), 2U, nullptr, I2c::Status::idle, nullptr};
+
+    BMPP_CHECK(i2c1.submit(request));
+    event(sb, start);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_dr), 0xA0UL);
+    event(addr);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_dr), 0x10UL);
+
+    /* The register address is followed by a repeated start, no stop. */
+    event(btf);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & (start | stop), start);
+    /* BTF stays set until the repeated start is generated. */
+    event(btf);
+    event(sb, start);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_dr), 0xA1UL);
+
+    feed({0xD1U, 0xD2U, 0U, 0U});
+    event(addr);
+    event(rxne | btf);
+    BMPP_CHECK(request.status == I2c::Status::done);
+    BMPP_CHECK_EQUAL(rx[0], 0xD1U);
+    BMPP_CHECK_EQUAL(rx[1], 0xD2U);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & (start | stop), stop);
+    Register_file::write(i2c1_cr1, Register_file::read(i2c1_cr1) & ~stop);
+    BMPP_CHECK(!i2c1.is_busy());
+    teardown();
+}
+
+void test_errors() {
+    setup();
+    const uint8_t byte = 0x12U;
+    I2c::Request first = {0x50U, &byte, 1U, nullptr, 0U, nullptr, I2c::Status::idle, nullptr};
+    I2c::Request second = {0x51U, &byte, 1U, nullptr, 0U, nullptr, I2c::Status::idle, nullptr};
+
+    /* A NACK of the address ends the request, the next follows at once. */
+    BMPP_CHECK(i2c1.submit(first));
+    BMPP_CHECK(i2c1.submit(second));
+    event(sb, start);
+    Register_file::write(i2c1_sr1, af);
+    i2c1.handle_error();
+    Register_file::write(i2c1_sr1, 0UL);
+    BMPP_CHECK(first.status == I2c::Status::nack);
+    BMPP_CHECK(second.status == I2c::Status::pending);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & (start | stop), start);
+
+    /* A bus error resets the port, keeping its configuration. */
+    event(sb, start);
+    Register_file::write(i2c1_sr1, berr);
+    i2c1.handle_error();
+    Register_file::write(i2c1_sr1, 0UL);
+    BMPP_CHECK(second.status == I2c::Status::bus_error);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1), pe);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_ccr), 40UL);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_trise), 9UL);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr2), 0x0308UL);
+    BMPP_CHECK(!i2c1.is_busy());
+
+    /* After a lost arbitration the next request waits for thread context. */
+    BMPP_CHECK(i2c1.submit(first));
+    BMPP_CHECK(i2c1.submit(second));
+    event(sb, start);
+    Register_file::write(i2c1_sr1, arlo);
+    i2c1.handle_error();
+    Register_file::write(i2c1_sr1, 0UL);
+    BMPP_CHECK(first.status == I2c::Status::arbitration_lost);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & (start | stop), 0UL);
+    BMPP_CHECK(i2c1.is_busy());
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & (start | stop), start);
+    write_byte(0x51U);
+    BMPP_CHECK(second.status == I2c::Status::done);
+    Register_file::write(i2c1_cr1, Register_file::read(i2c1_cr1) & ~stop);
+    BMPP_CHECK(!i2c1.is_busy());
+
+    /* An error may end a request still waiting for the bus. */
+    Register_file::write(i2c1_sr2, busy);
+    BMPP_CHECK(i2c1.submit(first));
+    Register_file::write(i2c1_sr1, berr);
+    i2c1.handle_error();
+    Register_file::write(i2c1_sr1, 0UL);
+    Register_file::write(i2c1_sr2, 0UL);
+    BMPP_CHECK(first.status == I2c::Status::bus_error);
+    BMPP_CHECK(!i2c1.is_busy());
+    teardown();
+}
+
+void test_recover() {
+    setup();
+    const uint8_t byte = 0x12U;
+    I2c::Request request = {0x50U, &byte, 1U, nullptr, 0U, nullptr, I2c::Status::idle, nullptr};
+    const uint32_t pins = Register_file::read(gpiob_crl);
+
+    /* A device holds SDA low, so the bus stays busy. */
+    Register_file::write(i2c1_sr2, busy);
+    BMPP_CHECK(i2c1.submit(request));
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & start, 0UL);
+
+    /* SCL is clocked by hand until SDA is released, then a stop is sent
+       and the port takes the pins back. */
+    clock_pulses = 0UL;
+    Register_file::set_hook(gpiob_brr, brr_hook);
+    BMPP_CHECK(i2c1.is_busy());
+    Register_file::set_hook(gpiob_brr, nullptr);
+    BMPP_CHECK_EQUAL(clock_pulses, 5UL);
+    BMPP_CHECK_EQUAL(Register_file::read(gpiob_bsrr), sda_pin);
+    BMPP_CHECK_EQUAL(Register_file::read(gpiob_crl), pins);
+    BMPP_CHECK_EQUAL(Register_file::read(i2c1_cr1) & (pe | start), pe | start);
+
+    write_byte(0x50U);
+    BMPP_CHECK(request.status == I2c::Status::done);
+    Register_file::write(i2c1_cr1, Register_file::read(i2c1_cr1) & ~stop);
+    BMPP_CHECK(!i2c1.is_busy());
+    teardown();
+}
+
+} /* namespace */
+
+int main() {
+    test_queue();
+    test_callback();
+    test_read();
+    test_write_read();
+    test_errors();
+    test_recover();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
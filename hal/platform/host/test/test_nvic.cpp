@@ -0,0 +1,108 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_nvic.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Enable, pending and priority registers of the NVIC driver.
+ */
+
+/* System. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "irq.hpp"
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+using bmpp::hal::stm32f10xxx::Irq;
+using bmpp::hal::stm32f10xxx::Nvic;
+using bmpp::hal::cortex_m3::Exception;
+
+namespace {
+
+const uint32_t iser0 = 0xE000'E100UL;       /**< Set-enable, IRQ0-31.       */
+const uint32_t iser1 = 0xE000'E104UL;       /**< Set-enable, IRQ32-63.      */
+const uint32_t icer1 = 0xE000'E184UL;       /**< Clear-enable, IRQ32-63.    */
+const uint32_t ispr0 = 0xE000'E200UL;       /**< Set-pending, IRQ0-31.      */
+const uint32_t icpr0 = 0xE000'E280UL;       /**< Clear-pending, IRQ0-31.    */
+const uint32_t iabr1 = 0xE000'E304UL;       /**< Active, IRQ32-63.          */
+const uint32_t ipr7 = 0xE000'E41CUL;        /**< Priority, IRQ28-31.        */
+const uint32_t shpr3 = 0xE000'ED20UL;       /**< Priority, PendSV, SysTick. */
+const uint32_t aircr = 0xE000'ED0CUL;       /**< Interrupt and reset.       */
+const uint32_t stir = 0xE000'EF00UL;        /**< Software trigger.          */
+
+static_assert(Nvic::priority_levels == 16U, "Four priority bits.");
+static_assert(Nvic::encode_priority(2U, 1U, 3U) == 0x7U, "Preemption 1, sub-priority 3.");
+static_assert(Nvic::encode_priority(4U, 9U, 1U) == 0x9U, "No sub-priority bits.");
+static_assert(Nvic::encode_priority(0U, 1U, 9U) == 0x9U, "No preemption bits.");
+
+void test_enable() {
+    host::test::reset();
+    /* Set and clear registers are only stored, never read back. */
+    nvic.enable(Irq::tim2);
+    BMPP_CHECK_EQUAL(Register_file::read(iser0), (1UL << 28UL));
+    nvic.enable(Irq::usart1);
+    BMPP_CHECK_EQUAL(Register_file::read(iser1), (1UL << 5UL));
+    BMPP_CHECK(nvic.is_enabled(Irq::usart1));
+    BMPP_CHECK(!nvic.is_enabled(Irq::exti0));
+    nvic.disable(Irq::usart1);
+    BMPP_CHECK_EQUAL(Register_file::read(icer1), (1UL << 5UL));
+}
+
+void test_pending() {
+    host::test::reset();
+    nvic.set_pending(Irq::exti0);
+    BMPP_CHECK_EQUAL(Register_file::read(ispr0), (1UL << 6UL));
+    BMPP_CHECK(nvic.is_pending(Irq::exti0));
+    nvic.clear_pending(Irq::exti0);
+    BMPP_CHECK_EQUAL(Register_file::read(icpr0), (1UL << 6UL));
+
+    Register_file::write(iabr1, (1UL << 5UL));
+    BMPP_CHECK(nvic.is_active(Irq::usart1));
+    BMPP_CHECK(!nvic.is_active(Irq::tim2));
+
+    nvic.trigger(Irq::usart1);
+    BMPP_CHECK_EQUAL(Register_file::read(stir), 37UL);
+}
+
+void test_priority() {
+    host::test::reset();
+    /* Priorities live in the upper bits of their byte. */
+    nvic.set_priority(Irq::tim2, 5U);
+    nvic.set_priority(Irq::tim3, 15U);
+    BMPP_CHECK_EQUAL(Register_file::read(ipr7), 0x0000'F050UL);
+    BMPP_CHECK_EQUAL(nvic.get_priority(Irq::tim2), 5U);
+
+    nvic.set_priority(Exception::systick, 2U);
+    nvic.set_priority(Exception::pendsv, 15U);
+    BMPP_CHECK_EQUAL(Register_file::read(shpr3), 0x20F0'0000UL);
+    BMPP_CHECK_EQUAL(nvic.get_priority(Exception::systick), 2U);
+}
+
+void test_grouping() {
+    host::test::reset();
+    nvic.set_priority_grouping(2U);
+    BMPP_CHECK_EQUAL(Register_file::read(aircr), 0x05FA'0500UL);
+    BMPP_CHECK_EQUAL(nvic.get_priority_grouping(), 2U);
+    /* More preemption bits than implemented use all of them. */
+    nvic.set_priority_grouping(7U);
+    BMPP_CHECK_EQUAL(Register_file::read(aircr), 0x05FA'0300UL);
+    BMPP_CHECK_EQUAL(nvic.get_priority_grouping(), 4U);
+}
+
+} /* namespace */
+
+int main() {
+    test_enable();
+    test_pending();
+    test_priority();
+    test_grouping();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
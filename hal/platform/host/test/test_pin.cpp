@@ -0,0 +1,79 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_pin.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Compile-time pin types of the GPIO driver.
+ */
+
+/* System. */
+#include <type_traits>      /* Type properties. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "gpio.hpp"
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+
+namespace {
+
+const uint32_t port_c = 0x4001'1000UL;      /**< Port C registers. */
+const uint32_t crh = 0x04UL;
+const uint32_t idr = 0x08UL;
+const uint32_t odr = 0x0CUL;
+const uint32_t bsrr = 0x10UL;
+const uint32_t brr = 0x14UL;
+
+using Led = Static_pin<2U, 13U>;            /**< Pin C13. */
+
+static_assert(std::is_empty<Led>::value, "Static pin holds no storage.");
+static_assert(Led::mask() == (1UL << 13UL), "Mask of the pin.");
+static_assert(Led::number() == 13U, "Number of the pin.");
+static_assert(Led::address() == port_c, "Base address of the port.");
+
+void test_static_pin() {
+    host::test::reset();
+    Register_file::write(port_c + crh, 0x4444'4444UL);
+
+    Led::config(Pin::Config::output_opendrain);
+    BMPP_CHECK_EQUAL(Register_file::read(port_c + crh), 0x4464'4444UL);
+
+    Led::set();
+    BMPP_CHECK_EQUAL(Register_file::read(port_c + bsrr), 0x0000'2000UL);
+    Led::clear();
+    BMPP_CHECK_EQUAL(Register_file::read(port_c + brr), 0x0000'2000UL);
+    Led::set(Pin::State::high);
+    BMPP_CHECK_EQUAL(Register_file::read(port_c + bsrr), 0x0000'2000UL);
+    Register_file::write(port_c + odr, 0x2000UL);
+    Led::toggle();
+    BMPP_CHECK_EQUAL(Register_file::read(port_c + bsrr), 0x2000'0000UL);
+
+    Register_file::write(port_c + idr, 0x2000UL);
+    BMPP_CHECK(Led::get() == Pin::State::high);
+    Register_file::write(port_c + idr, 0x0000UL);
+    BMPP_CHECK(Led::get() == Pin::State::low);
+}
+
+void test_conversion() {
+    host::test::reset();
+    /* A static pin converts to a runtime pin of the same port and number. */
+    const Pin pin = Led();
+    pin.set(Pin::State::low);
+    BMPP_CHECK_EQUAL(Register_file::read(port_c + brr), 0x0000'2000UL);
+}
+
+} /* namespace */
+
+int main() {
+    test_static_pin();
+    test_conversion();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,95 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_pin_group.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Pin groups spanning pins of multiple ports.
+ */
+
+/* System. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "gpio.hpp"
+#include "pin_group.hpp"
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+
+namespace {
+
+const uint32_t port_a = 0x4001'0800UL;      /**< Port A registers. */
+const uint32_t port_b = 0x4001'0C00UL;      /**< Port B registers. */
+const uint32_t crl = 0x00UL;
+const uint32_t crh = 0x04UL;
+const uint32_t idr = 0x08UL;
+const uint32_t odr = 0x0CUL;
+const uint32_t bsrr = 0x10UL;
+
+using Group = Pin_group<Static_pin<0U, 1U>, Static_pin<1U, 3U>, Static_pin<0U, 4U>>;
+
+static_assert(Group::size() == 3UL, "Pins in the group.");
+
+/**
+ *  Reset state of the configuration registers, all pins floating inputs.
+ *  @return None.
+ */
+void reset_ports() {
+    host::test::reset();
+    for(const uint32_t port : {port_a, port_b}) {
+        Register_file::write(port + crl, 0x4444'4444UL);
+        Register_file::write(port + crh, 0x4444'4444UL);
+    }
+}
+
+void test_config() {
+    reset_ports();
+    Group::config(Pin::Config::output_pushpull);
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + crl), 0x4442'4424UL);
+    BMPP_CHECK_EQUAL(Register_file::read(port_b + crl), 0x4444'2444UL);
+}
+
+void test_outputs() {
+    reset_ports();
+    Group::set();
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + bsrr), 0x0000'0012UL);
+    BMPP_CHECK_EQUAL(Register_file::read(port_b + bsrr), 0x0000'0008UL);
+
+    /* Bit n of a value drives the n-th pin, one store per port. */
+    Group::write(0b101UL);
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + bsrr), 0x0000'0012UL);
+    BMPP_CHECK_EQUAL(Register_file::read(port_b + bsrr), 0x0008'0000UL);
+    Group::write(0b010UL);
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + bsrr), 0x0012'0000UL);
+    BMPP_CHECK_EQUAL(Register_file::read(port_b + bsrr), 0x0000'0008UL);
+
+    /* Toggling leaves the other pins of the ports alone. */
+    Register_file::write(port_a + odr, 0x0013UL);
+    Register_file::write(port_b + odr, 0x0000UL);
+    Group::toggle();
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + bsrr), 0x0012'0000UL);
+    BMPP_CHECK_EQUAL(Register_file::read(port_b + bsrr), 0x0000'0008UL);
+}
+
+void test_read() {
+    reset_ports();
+    Register_file::write(port_a + idr, 0x0010UL);
+    Register_file::write(port_b + idr, 0x0008UL);
+    BMPP_CHECK_EQUAL(Group::read(), 0b110UL);
+}
+
+} /* namespace */
+
+int main() {
+    test_config();
+    test_outputs();
+    test_read();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,140 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_rcc.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Clock tree solutions and their application by the RCC driver.
+ */
+
+/* System. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "clock_tree.hpp"
+#include "rcc.hpp"
+
+using namespace bmpp::hal;
+using namespace bmpp::hal::stm32f10xxx;
+using bmpp::hal::host::Register_file;
+
+namespace {
+
+const uint32_t rcc_cr = 0x4002'1000UL;      /**< Clock control.         */
+const uint32_t rcc_cfgr = 0x4002'1004UL;    /**< Clock configuration.   */
+const uint32_t flash_acr = 0x4002'2000UL;   /**< Flash access control.  */
+
+uint32_t pclk1_max = 0UL;   /**< Fastest PCLK1 seen while switching. */
+
+/**
+ *  Derives PCLK1 from the clock configuration register, tracking its
+ *  maximum, while the switch status follows the switch as the model does.
+ *  The PLL keeps the 72 MHz it was locked at, as its multiplier only
+ *  takes effect when it is enabled again.
+ */
+void cfgr_hook(const uint32_t&, volatile uint32_t& reg) {
+    reg = ((reg & ~(3UL << 2UL)) | ((reg & 3UL) << 2UL));
+    const uint32_t sws = ((reg >> 2UL) & 3UL);
+    const uint32_t sysclk = (sws == 2UL) ? 72'000'000UL : ((sws == 1UL) ? EXTCLK : Clock_limits::hsi);
+    const uint32_t hpre = ((reg >> 4UL) & 0xFUL);
+    const uint32_t hclk = (hpre < 8UL) ? sysclk : (sysclk >> ((hpre < 12UL) ? (hpre - 7UL) : (hpre - 6UL)));
+    const uint32_t ppre1 = ((reg >> 8UL) & 7UL);
+    const uint32_t pclk1 = (ppre1 < 4UL) ? hclk : (hclk >> (ppre1 - 3UL));
+    pclk1_max = (pclk1 > pclk1_max) ? pclk1 : pclk1_max;
+}
+
+static_assert(Clock_tree<72'000'000UL>::config.pclk1 == 36'000'000UL, "APB1 defaults within its limit.");
+static_assert(Clock_tree<72'000'000UL>::config.latency == 2UL, "72 MHz needs two wait states.");
+
+void test_solutions() {
+    const Clock_config pll_hse = solve_clock(8'000'000UL, 72'000'000UL, 72'000'000UL, 36'000'000UL, 72'000'000UL);
+    BMPP_CHECK(pll_hse.valid());
+    BMPP_CHECK_EQUAL(pll_hse.sw, 2UL);
+    BMPP_CHECK_EQUAL(pll_hse.pllsrc, 1UL);
+    BMPP_CHECK_EQUAL(pll_hse.pllxtpre, 0UL);
+    BMPP_CHECK_EQUAL(pll_hse.pllmul, 7UL);
+    BMPP_CHECK_EQUAL(pll_hse.hpre, 0UL);
+    BMPP_CHECK_EQUAL(pll_hse.ppre1, 4UL);
+    BMPP_CHECK_EQUAL(pll_hse.ppre2, 0UL);
+    BMPP_CHECK_EQUAL(pll_hse.adcpre, 2UL);
+    BMPP_CHECK_EQUAL(pll_hse.adcclk, 12'000'000UL);
+    BMPP_CHECK_EQUAL(pll_hse.usbclk, 48'000'000UL);
+    BMPP_CHECK_EQUAL(pll_hse.latency, 2UL);
+
+    const Clock_config pll_hsi = solve_clock(0UL, 64'000'000UL, 64'000'000UL, 32'000'000UL, 16'000'000UL);
+    BMPP_CHECK(pll_hsi.valid());
+    BMPP_CHECK_EQUAL(pll_hsi.pllsrc, 0UL);
+    BMPP_CHECK_EQUAL(pll_hsi.pllmul, 14UL);
+    BMPP_CHECK_EQUAL(pll_hsi.ppre2, 5UL);
+
+    const Clock_config hse = solve_clock(12'000'000UL, 12'000'000UL, 3'000'000UL, 3'000'000UL, 3'000'000UL);
+    BMPP_CHECK(hse.valid());
+    BMPP_CHECK_EQUAL(hse.sw, 1UL);
+    BMPP_CHECK_EQUAL(hse.hpre, 9UL);
+
+    BMPP_CHECK(solve_clock(20'000'000UL, 72'000'000UL, 72'000'000UL, 36'000'000UL, 72'000'000UL).error == Clock_error::hse_range);
+    BMPP_CHECK(solve_clock(8'000'000UL, 80'000'000UL, 80'000'000UL, 40'000'000UL, 80'000'000UL).error == Clock_error::sysclk_range);
+    BMPP_CHECK(solve_clock(8'000'000UL, 70'000'000UL, 70'000'000UL, 35'000'000UL, 70'000'000UL).error == Clock_error::sysclk_source);
+    BMPP_CHECK(solve_clock(8'000'000UL, 72'000'000UL, 72'000'000UL, 72'000'000UL, 72'000'000UL).error == Clock_error::pclk1_range);
+    BMPP_CHECK(solve_clock(8'000'000UL, 72'000'000UL, 72'000'000UL, 30'000'000UL, 72'000'000UL).error == Clock_error::pclk1_divider);
+}
+
+void test_set_clock() {
+    host::test::reset();
+
+    rcc.set_clock<72'000'000UL>();
+    BMPP_CHECK_EQUAL(rcc.get_clock().sysclk, 72'000'000UL);
+    /* HSE and PLL on, PLL x9 from HSE, APB1 /2, ADC /6, PLL selected. */
+    BMPP_CHECK_EQUAL(Register_file::read(rcc_cr) & 0x0101'0000UL, 0x0101'0000UL);
+    BMPP_CHECK_EQUAL(Register_file::read(rcc_cfgr), 0x001D'840AUL);
+    BMPP_CHECK_EQUAL(Register_file::read(flash_acr) & 7UL, 2UL);
+
+    BMPP_CHECK(rcc.set_clock(8'000'000UL));
+    BMPP_CHECK_EQUAL(rcc.get_clock().sysclk, 8'000'000UL);
+    BMPP_CHECK_EQUAL(Register_file::read(rcc_cfgr) & 0x0000'3FFFUL, 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(flash_acr) & 7UL, 0UL);
+
+    BMPP_CHECK(!rcc.set_clock(70'000'000UL));
+    BMPP_CHECK_EQUAL(rcc.get_clock().sysclk, 8'000'000UL);
+}
+
+void test_lower_clock() {
+    host::test::reset();
+    rcc.set_clock<72'000'000UL>();
+
+    /* From the PLL to 8 MHz with APB1 undivided, PCLK1 must stay in range.
+     * The hook replaces the one of the model for the rest of the test. */
+    Register_file::set_hook(rcc_cfgr, cfgr_hook);
+    pclk1_max = 0UL;
+    rcc.set_clock(solve_clock(EXTCLK, EXTCLK, EXTCLK, EXTCLK, EXTCLK));
+    BMPP_CHECK(pclk1_max <= Clock_limits::pclk1_max);
+    BMPP_CHECK_EQUAL(rcc.get_clock().pclk1, 8'000'000UL);
+    BMPP_CHECK_EQUAL(Register_file::read(rcc_cfgr) & 0x0000'070FUL, 0UL);
+    /* The PLL is off when unused. */
+    BMPP_CHECK_EQUAL(Register_file::read(rcc_cr) & 0x0100'0000UL, 0UL);
+}
+
+void test_timer_clocks() {
+    const Clock_config config = solve_clock(8'000'000UL, 72'000'000UL, 72'000'000UL, 36'000'000UL, 36'000'000UL);
+    BMPP_CHECK_EQUAL(config.apb1_timclk(), 72'000'000UL);
+    BMPP_CHECK_EQUAL(config.apb2_timclk(), 72'000'000UL);
+    const Clock_config undivided = solve_clock(8'000'000UL, 8'000'000UL, 8'000'000UL, 8'000'000UL, 8'000'000UL);
+    BMPP_CHECK_EQUAL(undivided.apb1_timclk(), 8'000'000UL);
+    BMPP_CHECK_EQUAL(undivided.apb2_timclk(), 8'000'000UL);
+}
+
+} /* namespace */
+
+int main() {
+    test_solutions();
+    test_set_clock();
+    test_lower_clock();
+    test_timer_clocks();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
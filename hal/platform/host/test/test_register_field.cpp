@@ -0,0 +1,119 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_register_field.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Masks, shifts and merging of register fields.
+ */
+
+/* System. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "register_field.hpp"
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+
+namespace {
+
+const uint32_t scratch = 0x4000'0000UL;     /**< Scratch register.  */
+
+/**
+ *  Layout of the scratch register.
+ */
+struct Scratch {
+
+    enum class Mode : uint32_t {
+        off     = 0UL,
+        slow    = 3UL,
+        fast    = 5UL
+    };
+
+    using en        = Field<Scratch, 0UL, 1UL, Access_policy::read_write, bool>;
+    using mode      = Field<Scratch, 4UL, 3UL, Access_policy::read_write, Mode>;
+    using prescaler = Field<Scratch, 8UL, 8UL>;
+    using top       = Field<Scratch, 31UL, 1UL>;
+    using status    = Field<Scratch, 28UL, 2UL, Access_policy::read_only>;
+
+};
+
+/* Masks and shifts are known at compile time. */
+static_assert(Scratch::en::mask() == 0x0000'0001UL, "Mask of a single bit.");
+static_assert(Scratch::mode::mask() == 0x0000'0070UL, "Mask of a shifted field.");
+static_assert(Scratch::prescaler::mask() == 0x0000'FF00UL, "Mask of a byte.");
+static_assert(Scratch::top::mask() == 0x8000'0000UL, "Mask of the top bit.");
+static_assert(Scratch::mode::value(Scratch::Mode::fast).bits() == 0x0000'0050UL, "Value in place.");
+static_assert(Scratch::prescaler::get(0x1234'5678UL) == 0x56UL, "Field out of a register.");
+static_assert(Scratch::mode::get(0x0000'0035UL) == Scratch::Mode::slow, "Enumeration out of a register.");
+static_assert(Scratch::status::get(0x3000'0000UL) == 3UL, "Read only field out of a register.");
+
+void test_value() {
+    /* Values wider than their field are cut to it. */
+    const Field_value<Scratch> wide = Scratch::prescaler::value(0x1FFUL);
+    BMPP_CHECK_EQUAL(wide.mask(), 0x0000'FF00UL);
+    BMPP_CHECK_EQUAL(wide.bits(), 0x0000'FF00UL);
+
+    BMPP_CHECK_EQUAL(Scratch::top::set().bits(), 0x8000'0000UL);
+    BMPP_CHECK_EQUAL(Scratch::top::clear().mask(), 0x8000'0000UL);
+    BMPP_CHECK_EQUAL(Scratch::top::clear().bits(), 0UL);
+    BMPP_CHECK_EQUAL(Scratch::en::value(true).bits(), 1UL);
+    BMPP_CHECK(Scratch::en::get(0x0000'0001UL));
+    BMPP_CHECK(!Scratch::en::get(0xFFFF'FFFEUL));
+}
+
+void test_merge() {
+    /* Fields combine into one mask, untouched bits are kept on apply. */
+    const Field_value<Scratch> values = (Scratch::en::set()
+                                         | Scratch::mode::value(Scratch::Mode::slow)
+                                         | Scratch::prescaler::value(0x12UL));
+    BMPP_CHECK_EQUAL(values.mask(), 0x0000'FF71UL);
+    BMPP_CHECK_EQUAL(values.bits(), 0x0000'1231UL);
+    BMPP_CHECK_EQUAL(values.apply(0xFFFF'FFFFUL), 0xFFFF'12BFUL);
+    BMPP_CHECK_EQUAL(values.apply(0UL), 0x0000'1231UL);
+
+    /* Of overlapping values the righthand one wins. */
+    const Field_value<Scratch> later = (Scratch::mode::value(Scratch::Mode::fast)
+                                        | Scratch::mode::value(Scratch::Mode::slow));
+    BMPP_CHECK_EQUAL(later.mask(), 0x0000'0070UL);
+    BMPP_CHECK_EQUAL(later.bits(), 0x0000'0030UL);
+    const Field_value<Scratch> cleared = (Scratch::prescaler::set() | Scratch::prescaler::clear());
+    BMPP_CHECK_EQUAL(cleared.bits(), 0UL);
+}
+
+void test_register() {
+    host::test::reset();
+    const Field_register<Scratch> reg(scratch);
+    Register_file::write(scratch, 0x3000'0000UL);
+
+    /* Modify keeps the bits outside the fields. */
+    reg.modify(Scratch::en::set() | Scratch::mode::value(Scratch::Mode::fast));
+    BMPP_CHECK_EQUAL(Register_file::read(scratch), 0x3000'0051UL);
+    BMPP_CHECK(reg.read<Scratch::en>());
+    BMPP_CHECK(reg.read<Scratch::mode>() == Scratch::Mode::fast);
+    BMPP_CHECK_EQUAL(reg.read<Scratch::status>(), 3UL);
+    BMPP_CHECK(reg.matches(Scratch::en::set() | Scratch::mode::value(Scratch::Mode::fast)));
+    BMPP_CHECK(!reg.matches(Scratch::en::set() | Scratch::mode::value(Scratch::Mode::slow)));
+
+    /* Write clears the bits outside the fields. */
+    reg.write(Scratch::prescaler::value(0xA5UL));
+    BMPP_CHECK_EQUAL(Register_file::read(scratch), 0x0000'A500UL);
+    BMPP_CHECK_EQUAL(reg.read<Scratch::prescaler>(), 0xA5UL);
+    BMPP_CHECK(!reg.read<Scratch::en>());
+}
+
+} /* namespace */
+
+int main() {
+    test_value();
+    test_merge();
+    test_register();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,95 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_register_file.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Storage and hooks of the simulated register file.
+ */
+
+/* System. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "mem_access.hpp"
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+
+namespace {
+
+const uint32_t first  = 0x4000'0000UL;      /**< Register of a fresh page.  */
+const uint32_t second = 0x4000'0004UL;      /**< Next register.             */
+const uint32_t other  = 0x4001'0000UL;      /**< Register of another page.  */
+const uint32_t hooked = 0x4000'0008UL;      /**< Register with a hook.      */
+
+uint32_t hook_calls;    /**< Hook invocations.  */
+
+/**
+ *  Counts accesses and keeps bit 1 following bit 0, like a ready flag.
+ */
+void ready_hook(const uint32_t&, volatile uint32_t& reg) {
+    hook_calls++;
+    reg = ((reg & ~2UL) | ((reg & 1UL) << 1UL));
+}
+
+void test_storage() {
+    host::test::reset();
+    /* Registers read as zero until written. */
+    BMPP_CHECK_EQUAL(Register_file::read(first), 0UL);
+    Register_file::write(first, 0x1234'5678UL);
+    Register_file::write(other, 0x9ABC'DEF0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(first), 0x1234'5678UL);
+    BMPP_CHECK_EQUAL(Register_file::read(second), 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(other), 0x9ABC'DEF0UL);
+
+    Register_file::write_bit(second, 31U, true);
+    BMPP_CHECK(Register_file::read_bit(second, 31U));
+    Register_file::write_bit(second, 31U, false);
+    BMPP_CHECK_EQUAL(Register_file::read(second), 0UL);
+
+    /* Memory_register maps onto the same storage. */
+    const Memory_register<Access_policy::read_write> reg(first);
+    reg |= 0x0000'000FUL;
+    BMPP_CHECK_EQUAL(Register_file::read(first), 0x1234'567FUL);
+
+    host::test::reset();
+    BMPP_CHECK_EQUAL(Register_file::read(first), 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(other), 0UL);
+}
+
+void test_hook() {
+    host::test::reset();
+    hook_calls = 0UL;
+    Register_file::set_hook(hooked, ready_hook);
+    Register_file::write(hooked, 1UL);
+    BMPP_CHECK_EQUAL(Register_file::read(hooked), 3UL);
+    BMPP_CHECK_EQUAL(hook_calls, 2UL);
+
+    /* Hooks survive a reset and run for their register only. */
+    host::test::reset();
+    Register_file::write(second, 1UL);
+    BMPP_CHECK_EQUAL(Register_file::read(second), 1UL);
+    BMPP_CHECK_EQUAL(hook_calls, 2UL);
+    Register_file::write(hooked, 1UL);
+    BMPP_CHECK_EQUAL(Register_file::read(hooked), 3UL);
+
+    Register_file::set_hook(hooked, nullptr);
+    Register_file::write(hooked, 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(hooked), 0UL);
+    BMPP_CHECK_EQUAL(hook_calls, 4UL);
+}
+
+} /* namespace */
+
+int main() {
+    test_storage();
+    test_hook();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
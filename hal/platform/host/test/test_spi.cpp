@@ -0,0 +1,206 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_spi.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Clock, frame size and transaction queue of the SPI driver.
+ */
+
+/* System. */
+#include <array>            /* Buffers. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "gpio.hpp"
+#include "spi.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  DMA1 channel 2 handler of the driver, outside the vector table.
+ */
+void dma1_channel2_handler();
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+using Spi = bmpp::hal::stm32f10xxx::Spi;
+
+namespace {
+
+const uint32_t spi1_cr1 = 0x4001'3000UL;    /**< SPI1 control 1.                */
+const uint32_t spi1_cr2 = 0x4001'3004UL;    /**< SPI1 control 2.                */
+const uint32_t spi1_dr = 0x4001'300CUL;     /**< SPI1 data.                     */
+const uint32_t gpiob_bsrr = 0x4001'0C10UL;  /**< Port B bit set/reset.          */
+const uint32_t gpiob_brr = 0x4001'0C14UL;   /**< Port B bit reset.              */
+const uint32_t dma_isr = 0x4002'0000UL;     /**< Interrupt status.              */
+const uint32_t ccr2 = 0x4002'001CUL;        /**< Channel 2 configuration.       */
+const uint32_t cndtr2 = 0x4002'0020UL;      /**< Channel 2 number of data.      */
+const uint32_t cpar2 = 0x4002'0024UL;       /**< Channel 2 peripheral address.  */
+const uint32_t cmar2 = 0x4002'0028UL;       /**< Channel 2 memory address.      */
+const uint32_t cndtr3 = 0x4002'0034UL;      /**< Channel 3 number of data.      */
+const uint32_t cmar3 = 0x4002'003CUL;       /**< Channel 3 memory address.      */
+const uint32_t nvic_iser0 = 0xE000'E100UL;  /**< Interrupt set-enable.          */
+
+const uint32_t tcif2 = (1UL << 5UL);        /**< Channel 2 complete.            */
+const uint32_t gif2 = (1UL << 4UL);         /**< Channel 2 any event.           */
+const uint32_t minc = (1UL << 7UL);         /**< CCR memory increment.          */
+const uint32_t dma_ch2_irq = (1UL << 12UL); /**< DMA1 channel 2 interrupt.      */
+
+Spi::Transaction* completed[4];             /**< Ended transactions in order.   */
+uint32_t completed_count;                   /**< Number of ended transactions.  */
+uint32_t started_count;                     /**< Frames of the started one.     */
+Spi::Transaction* chained;                  /**< Submitted from a callback.     */
+
+void on_done(Spi::Transaction& transaction) {
+    if(completed_count < 4UL) {
+        completed[completed_count] = &transaction;
+    }
+    completed_count++;
+    /* The next transaction has been started before reporting. */
+    started_count = Register_file::read(cndtr3);
+    if(chained != nullptr) {
+        BMPP_CHECK(spi1.submit(*chained));
+        chained = nullptr;
+    }
+}
+
+/**
+ *  Ends the running transaction as the DMA would, with its last received
+ *  frame.
+ *  @return None.
+ */
+void complete() {
+    Register_file::write(cndtr2, 0UL);
+    Register_file::write(cndtr3, 0UL);
+    Register_file::write(dma_isr, tcif2 | gif2);
+    stm32f10xxx::dma1_channel2_handler();
+    Register_file::write(dma_isr, 0UL);
+}
+
+void test_initialize() {
+    host::test::reset();
+    /* PCLK2 runs from the 8 MHz HSI after reset. */
+    BMPP_CHECK(spi1.initialize(1'000'000UL));
+    BMPP_CHECK_EQUAL(spi1.get_rate(), 1'000'000UL);
+    /* Master, divider 16, software select, enabled. */
+    BMPP_CHECK_EQUAL(Register_file::read(spi1_cr1), 0x0354UL);
+    BMPP_CHECK_EQUAL(Register_file::read(spi1_cr2), 0UL);
+
+    BMPP_CHECK(spi1.initialize(3'000'000UL, Spi::Mode::mode3, Spi::Frame::bits16, true));
+    BMPP_CHECK_EQUAL(spi1.get_rate(), 2'000'000UL);
+    BMPP_CHECK_EQUAL(Register_file::read(spi1_cr1), 0x0BCFUL);
+    BMPP_CHECK(!spi1.initialize(10'000UL));
+
+    /* Arrays of the wrong frame size are refused before queueing. */
+    BMPP_CHECK(spi1.initialize(1'000'000UL, Spi::Mode::mode0, Spi::Frame::bits16));
+    std::array<uint8_t, 2> tx = {};
+    std::array<uint8_t, 2> rx = {};
+    BMPP_CHECK(!spi1.transfer(tx, rx));
+    BMPP_CHECK(!spi1.is_busy());
+}
+
+void test_queue() {
+    host::test::reset();
+    BMPP_CHECK(spi1.initialize(1'000'000UL));
+    std::array<uint8_t, 3> tx = { 0x01U, 0x02U, 0x03U };
+    std::array<uint8_t, 3> rx = {};
+    Spi::Transaction first = {tx.data(), rx.data(), 3U, &gpio_b, 0x0001U, on_done, false, nullptr};
+    Spi::Transaction second = {tx.data(), nullptr, 2U, &gpio_b, 0x0002U, on_done, false, nullptr};
+    Spi::Transaction third = {tx.data(), nullptr, 1U, nullptr, 0U, on_done, false, nullptr};
+    Spi::Transaction empty = {tx.data(), nullptr, 0U, nullptr, 0U, nullptr, false, nullptr};
+    completed_count = 0UL;
+    chained = nullptr;
+
+    BMPP_CHECK(!spi1.submit(empty));
+    BMPP_CHECK(spi1.submit(first));
+    BMPP_CHECK(spi1.is_busy());
+    BMPP_CHECK(first.pending);
+    BMPP_CHECK_EQUAL(Register_file::read(gpiob_brr), 0x0001UL);
+    BMPP_CHECK_EQUAL(Register_file::read(cpar2), spi1_dr);
+    BMPP_CHECK_EQUAL(Register_file::read(cndtr2), 3UL);
+    BMPP_CHECK_EQUAL(Register_file::read(cmar2), static_cast<uint32_t>(reinterpret_cast<uintptr_t>(rx.data())));
+    BMPP_CHECK_EQUAL(Register_file::read(cndtr3), 3UL);
+    BMPP_CHECK_EQUAL(Register_file::read(spi1_cr2), 0x0003UL);
+    BMPP_CHECK_EQUAL(Register_file::read(nvic_iser0) & dma_ch2_irq, dma_ch2_irq);
+
+    /* Queued behind the first, a pending transaction is not queued twice. */
+    BMPP_CHECK(spi1.submit(second));
+    BMPP_CHECK(!spi1.submit(first));
+    BMPP_CHECK_EQUAL(Register_file::read(cndtr3), 3UL);
+    BMPP_CHECK_EQUAL(Register_file::read(nvic_iser0) & dma_ch2_irq, dma_ch2_irq);
+
+    /* The next one starts before the first is reported, whose callback
+       queues a third. */
+    chained = &third;
+    complete();
+    BMPP_CHECK_EQUAL(completed_count, 1UL);
+    BMPP_CHECK(completed[0] == &first);
+    BMPP_CHECK(!first.pending);
+    BMPP_CHECK(second.pending);
+    BMPP_CHECK(third.pending);
+    BMPP_CHECK_EQUAL(started_count, 2UL);
+    BMPP_CHECK_EQUAL(Register_file::read(gpiob_bsrr), 0x0001UL);
+    BMPP_CHECK_EQUAL(Register_file::read(gpiob_brr), 0x0002UL);
+    /* Without a receive buffer, frames are drained into one element. */
+    BMPP_CHECK_EQUAL(Register_file::read(ccr2) & minc, 0UL);
+
+    complete();
+    BMPP_CHECK_EQUAL(completed_count, 2UL);
+    BMPP_CHECK(completed[1] == &second);
+    BMPP_CHECK_EQUAL(started_count, 1UL);
+    BMPP_CHECK_EQUAL(Register_file::read(gpiob_bsrr), 0x0002UL);
+    BMPP_CHECK(spi1.is_busy());
+
+    complete();
+    BMPP_CHECK_EQUAL(completed_count, 3UL);
+    BMPP_CHECK(completed[2] == &third);
+    BMPP_CHECK(!third.pending);
+    BMPP_CHECK(!spi1.is_busy());
+    BMPP_CHECK_EQUAL(Register_file::read(spi1_cr2), 0UL);
+
+    /* A stray interrupt with an empty queue is ignored. */
+    complete();
+    BMPP_CHECK_EQUAL(completed_count, 3UL);
+}
+
+void test_frames() {
+    host::test::reset();
+    BMPP_CHECK(spi1.initialize(1'000'000UL, Spi::Mode::mode0, Spi::Frame::bits16));
+    std::array<uint16_t, 2> tx = { 0x1234U, 0x5678U };
+    std::array<uint16_t, 2> rx = {};
+    Spi::Transaction transaction = {tx.data(), rx.data(), 2U, nullptr, 0U, nullptr, false, nullptr};
+
+    /* Both channels move half words. */
+    BMPP_CHECK(spi1.submit(transaction));
+    BMPP_CHECK_EQUAL(Register_file::read(ccr2) & 0x0F00UL, 0x0500UL);
+    BMPP_CHECK_EQUAL(Register_file::read(cmar3), static_cast<uint32_t>(reinterpret_cast<uintptr_t>(tx.data())));
+    complete();
+    BMPP_CHECK(!transaction.pending);
+    BMPP_CHECK(!spi1.is_busy());
+}
+
+} /* namespace */
+
+int main() {
+    test_initialize();
+    test_queue();
+    test_frames();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,101 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_timebase.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Tick rates and time keeping of the time base.
+ */
+
+/* System. */
+#include <chrono>           /* Settling time.   */
+#include <thread>           /* Sleep.           */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "rcc.hpp"
+#include "timebase.hpp"
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+
+namespace {
+
+const uint32_t systick_csr = 0xE000'E010UL;     /**< SysTick control and status.    */
+const uint32_t systick_rvr = 0xE000'E014UL;     /**< SysTick reload value.          */
+const uint32_t systick_cvr = 0xE000'E018UL;     /**< SysTick current value.         */
+const uint32_t scb_icsr = 0xE000'ED04UL;        /**< Interrupt control and state.   */
+const uint32_t pendstset = (1UL << 26UL);       /**< SysTick exception pending.     */
+
+/**
+ *  Stops the simulated SysTick, so the counter only changes when written.
+ *  @return None.
+ */
+void freeze() {
+    Register_file::write(systick_csr, 0UL);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+}
+
+void test_start() {
+    host::test::reset();
+    rcc.set_clock<72'000'000UL>();
+    BMPP_CHECK(timebase.start(5UL));
+    BMPP_CHECK_EQUAL(Register_file::read(systick_rvr), 14'399'999UL);
+    BMPP_CHECK(timebase.start(1000UL));
+    BMPP_CHECK_EQUAL(Register_file::read(systick_rvr), 71'999UL);
+
+    /* Periods above 2^24 cycles and rates not dividing HCLK are refused,
+     * leaving the running time base alone. */
+    BMPP_CHECK(!timebase.start(1UL));
+    BMPP_CHECK(!timebase.start(7UL));
+    BMPP_CHECK(!timebase.start(0UL));
+    BMPP_CHECK_EQUAL(Register_file::read(systick_rvr), 71'999UL);
+    BMPP_CHECK_EQUAL(Register_file::read(systick_csr) & 3UL, 3UL);
+    const uint64_t ticks = timebase.get_ticks64();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    BMPP_CHECK(timebase.get_ticks64() > ticks);
+    BMPP_CHECK_EQUAL(timebase.get_cycles_per_us(), 72UL);
+    freeze();
+}
+
+void test_pending() {
+    const uint64_t ticks = timebase.get_ticks64();
+    Register_file::write(scb_icsr, 0UL);
+    Register_file::write(systick_cvr, 71'999UL - 36'000UL);
+    const uint64_t before = timebase.get_micros();
+    BMPP_CHECK_EQUAL(before, (ticks * 1000ULL) + 500ULL);
+
+    /* Wrapped with the exception masked: the tick is not counted yet. */
+    Register_file::write(scb_icsr, pendstset);
+    Register_file::write(systick_cvr, 71'999UL - 1'000UL);
+    const uint64_t after = timebase.get_micros();
+    BMPP_CHECK_EQUAL(after, (ticks * 1000ULL) + 1000ULL + 13ULL);
+    BMPP_CHECK(after > before);
+    Register_file::write(scb_icsr, 0UL);
+}
+
+void test_fractional_rate() {
+    /* 1e6 / 3000 is no whole number of microseconds. */
+    BMPP_CHECK(timebase.start(3000UL));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    freeze();
+    const uint64_t ticks = timebase.get_ticks64();
+    Register_file::write(systick_cvr, 23'999UL);
+    BMPP_CHECK_EQUAL(timebase.get_micros(), (ticks * 1'000'000ULL) / 3000ULL);
+    BMPP_CHECK_EQUAL(timebase.get_millis(), (ticks * 1000ULL) / 3000ULL);
+}
+
+} /* namespace */
+
+int main() {
+    test_start();
+    test_pending();
+    test_fractional_rate();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
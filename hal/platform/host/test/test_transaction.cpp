@@ -0,0 +1,106 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_transaction.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Coalescing of register updates by register transactions.
+ */
+
+/* System. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "gpio.hpp"
+#include "register_transaction.hpp"
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+
+namespace {
+
+const uint32_t port_a = 0x4001'0800UL;      /**< Port A registers.  */
+const uint32_t crl = 0x00UL;
+const uint32_t crh = 0x04UL;
+const uint32_t first = 0x4000'0000UL;       /**< Scratch register.  */
+const uint32_t second = 0x4000'0004UL;      /**< Scratch register.  */
+
+/**
+ *  Reset state of the configuration registers, all pins floating inputs.
+ *  @return None.
+ */
+void reset_ports() {
+    host::test::reset();
+    Register_file::write(port_a + crl, 0x4444'4444UL);
+    Register_file::write(port_a + crh, 0x4444'4444UL);
+}
+
+void test_coalesce() {
+    reset_ports();
+    {
+        Register_transaction<4> transaction;
+        gpio_a.config_pins(transaction, 0x0003UL, Pin::Config::alternate_pushpull);
+        gpio_a.config_pin(transaction, 9U, Pin::Config::alternate_pushpull);
+        gpio_a.config_pin(transaction, 2U, Pin::Config::input_pull);
+        /* Updates of a register coalesce into one entry. */
+        BMPP_CHECK_EQUAL(transaction.size(), 2UL);
+        BMPP_CHECK_EQUAL(Register_file::read(port_a + crl), 0x4444'4444UL);
+        transaction.commit();
+        BMPP_CHECK_EQUAL(transaction.size(), 0UL);
+    }
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + crl), 0x4444'48BBUL);
+    BMPP_CHECK_EQUAL(Register_file::read(port_a + crh), 0x4444'44B4UL);
+}
+
+void test_write() {
+    host::test::reset();
+    const Memory_register<Access_policy::read_write> read_write(first);
+    const Memory_register<Access_policy::write_only> write_only(second);
+    Register_file::write(first, 0xFFFF'0000UL);
+    Register_file::write(second, 0xFFFF'0000UL);
+
+    Register_transaction<2> transaction;
+    transaction.modify(read_write, 0x0000'00F0UL, 0x0000'0050UL);
+    transaction.modify(read_write, 0x0000'000FUL, 0x0000'0003UL);
+    /* A later update of the same bits wins. */
+    transaction.modify(read_write, 0x0000'0003UL, 0x0000'0001UL);
+    transaction.modify(write_only, 0x0000'00FFUL, 0x0000'0012UL);
+    transaction.commit();
+    BMPP_CHECK_EQUAL(Register_file::read(first), 0xFFFF'0051UL);
+    /* Write only registers are not read, untouched bits are written zero. */
+    BMPP_CHECK_EQUAL(Register_file::read(second), 0x0000'0012UL);
+}
+
+void test_capacity() {
+    host::test::reset();
+    const Memory_register<Access_policy::read_write> read_write(first);
+    const Memory_register<Access_policy::read_write> other(second);
+
+    Register_transaction<1> transaction;
+    transaction.modify(read_write, 0x0000'000FUL, 0x0000'0001UL);
+    /* A register beyond the capacity commits the pending updates first. */
+    transaction.modify(other, 0x0000'000FUL, 0x0000'0002UL);
+    BMPP_CHECK_EQUAL(transaction.size(), 1UL);
+    BMPP_CHECK_EQUAL(Register_file::read(first), 0x0000'0001UL);
+    BMPP_CHECK_EQUAL(Register_file::read(second), 0UL);
+
+    transaction.discard();
+    BMPP_CHECK_EQUAL(transaction.size(), 0UL);
+    transaction.commit();
+    BMPP_CHECK_EQUAL(Register_file::read(second), 0UL);
+}
+
+} /* namespace */
+
+int main() {
+    test_coalesce();
+    test_write();
+    test_capacity();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,262 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_usart.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Baud rate dividers, receive ring, idle line and transmission of
+ *          the USART driver.
+ */
+
+/* System. */
+#include <array>            /* Buffers. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "usart.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  DMA1 channel 4 and 5 handlers of the driver, outside the vector table.
+ */
+void dma1_channel4_handler();
+void dma1_channel5_handler();
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+using Usart = bmpp::hal::stm32f10xxx::Usart;
+
+namespace {
+
+const uint32_t usart1_sr = 0x4001'3800UL;   /**< USART1 status.                 */
+const uint32_t usart1_dr = 0x4001'3804UL;   /**< USART1 data.                   */
+const uint32_t usart1_brr = 0x4001'3808UL;  /**< USART1 baud rate.              */
+const uint32_t usart1_cr1 = 0x4001'380CUL;  /**< USART1 control 1.              */
+const uint32_t usart1_cr3 = 0x4001'3814UL;  /**< USART1 control 3.              */
+const uint32_t usart2_brr = 0x4000'4408UL;  /**< USART2 baud rate.              */
+const uint32_t dma_isr = 0x4002'0000UL;     /**< Interrupt status.              */
+const uint32_t ccr4 = 0x4002'0044UL;        /**< Channel 4 configuration.       */
+const uint32_t cndtr4 = 0x4002'0048UL;      /**< Channel 4 number of data.      */
+const uint32_t ccr5 = 0x4002'0058UL;        /**< Channel 5 configuration.       */
+const uint32_t cndtr5 = 0x4002'005CUL;      /**< Channel 5 number of data.      */
+const uint32_t nvic_iser1 = 0xE000'E104UL;  /**< Interrupt set-enable 32-63.    */
+const uint32_t nvic_icer1 = 0xE000'E184UL;  /**< Interrupt clear-enable 32-63.  */
+
+const uint32_t idle = (1UL << 4UL);         /**< SR idle line.                  */
+const uint32_t tc = (1UL << 6UL);           /**< SR transmission complete.      */
+const uint32_t usart1_irq = (1UL << 5UL);   /**< USART1 interrupt, IRQ 37.      */
+const uint32_t tcif4 = (1UL << 13UL);       /**< Channel 4 complete.            */
+const uint32_t htif5 = (1UL << 18UL);       /**< Channel 5 half transfer.       */
+
+uint32_t receive_calls;                     /**< Receive notifications.         */
+uint32_t sent_calls;                        /**< Sent notifications.            */
+bool sr_read;                               /**< SR read since the last DR read. */
+
+void on_receive() {
+    receive_calls++;
+}
+
+void on_sent() {
+    sent_calls++;
+}
+
+/**
+ *  Notes reads of SR, the first step of clearing the idle flag.
+ *  @param[in]  address Address of SR.
+ *  @param[in]  reg     SR.
+ *  @return None.
+ */
+void sr_hook(const uint32_t&, volatile uint32_t&) {
+    sr_read = true;
+}
+
+/**
+ *  Clears the idle flag on a read of DR which follows a read of SR.
+ *  @param[in]  address Address of DR.
+ *  @param[in]  reg     DR.
+ *  @return None.
+ */
+void dr_hook(const uint32_t&, volatile uint32_t&) {
+    if(sr_read) {
+        Register_file::write(usart1_sr, Register_file::read(usart1_sr) & ~idle);
+    }
+    sr_read = false;
+}
+
+/**
+ *  Lets the receive DMA write bytes into the ring.
+ *  @param[in]  ring    Ring buffer.
+ *  @param[in]  head    Position of the first byte.
+ *  @param[in]  count   Number of bytes.
+ *  @param[in]  first   Value of the first byte, the next ones count up.
+ *  @return None.
+ */
+template<std::size_t N>
+void receive(std::array<uint8_t, N>& ring, const uint16_t& head, const uint16_t& count, const uint8_t& first) {
+    for(uint16_t i = 0U; i < count; i++) {
+        ring[(head + i) % N] = static_cast<uint8_t>(first + i);
+    }
+    Register_file::write(cndtr5, N - ((head + count) % N));
+}
+
+static_assert(Usart::brr(72'000'000UL, 115'200UL) == 625UL, "Exact divider.");
+static_assert(Usart::brr(8'000'000UL, 115'200UL) == 69UL, "Rounded divider.");
+static_assert(Usart::is_valid(72'000'000UL, 4'500'000UL), "Fastest rate of APB2.");
+static_assert(!Usart::is_valid(36'000'000UL, 3'000'000UL), "Above PCLK / 16.");
+static_assert(!Usart::is_valid(8'000'000UL, 485'000UL), "Error above tolerance.");
+
+void test_baud() {
+    host::test::reset();
+    usart1.set_baud<115'200UL, 72'000'000UL>();
+    BMPP_CHECK_EQUAL(Register_file::read(usart1_brr), 625UL);
+
+    /* PCLK2 runs from the 8 MHz HSI after reset. */
+    BMPP_CHECK(usart1.set_baud(115'200UL));
+    BMPP_CHECK_EQUAL(Register_file::read(usart1_brr), 69UL);
+    BMPP_CHECK(!usart1.set_baud(1'000'000UL));
+    BMPP_CHECK_EQUAL(Register_file::read(usart1_brr), 69UL);
+
+    rcc.set_clock<72'000'000UL>();
+    BMPP_CHECK(usart2.set_baud(2'250'000UL));
+    BMPP_CHECK_EQUAL(Register_file::read(usart2_brr), 16UL);
+    BMPP_CHECK(usart1.set_baud(4'500'000UL));
+    BMPP_CHECK_EQUAL(Register_file::read(usart1_brr), 16UL);
+}
+
+void test_ring() {
+    host::test::reset();
+    std::array<uint8_t, 8> ring = {};
+    std::array<uint8_t, 16> data = {};
+    receive_calls = 0UL;
+
+    usart1.start(ring, on_receive);
+    BMPP_CHECK_EQUAL(Register_file::read(cndtr5), 8UL);
+    BMPP_CHECK_EQUAL(Register_file::read(ccr5) & (1UL << 5UL), (1UL << 5UL));
+    BMPP_CHECK_EQUAL(Register_file::read(usart1_cr1), 0x201CUL);
+    BMPP_CHECK_EQUAL(Register_file::read(usart1_cr3), 0x00C0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(nvic_iser1) & usart1_irq, usart1_irq);
+    BMPP_CHECK_EQUAL(usart1.available(), 0U);
+
+    receive(ring, 0U, 5U, 0x10U);
+    BMPP_CHECK_EQUAL(usart1.available(), 5U);
+    BMPP_CHECK_EQUAL(usart1.read(data.data(), 3U), 3U);
+    BMPP_CHECK_EQUAL(data[0], 0x10U);
+    BMPP_CHECK_EQUAL(data[2], 0x12U);
+    BMPP_CHECK_EQUAL(usart1.available(), 2U);
+
+    /* The ring wraps, the bytes come out in order. */
+    receive(ring, 5U, 5U, 0x15U);
+    BMPP_CHECK_EQUAL(usart1.available(), 7U);
+    BMPP_CHECK_EQUAL(usart1.read(data.data(), static_cast<uint16_t>(data.size())), 7U);
+    for(uint16_t i = 0U; i < 7U; i++) {
+        BMPP_CHECK_EQUAL(data[i], 0x13U + i);
+    }
+    BMPP_CHECK_EQUAL(usart1.available(), 0U);
+    BMPP_CHECK_EQUAL(usart1.read(data.data(), 1U), 0U);
+
+    /* Every half ring is reported. */
+    Register_file::write(dma_isr, htif5 | (1UL << 16UL));
+    stm32f10xxx::dma1_channel5_handler();
+    Register_file::write(dma_isr, 0UL);
+    BMPP_CHECK_EQUAL(receive_calls, 1UL);
+
+    /* Without a callback the idle interrupt stays off. */
+    usart1.start(ring);
+    BMPP_CHECK_EQUAL(Register_file::read(usart1_cr1), 0x200CUL);
+    BMPP_CHECK_EQUAL(usart1.available(), 0U);
+    usart1.stop();
+}
+
+void test_idle() {
+    host::test::reset();
+    std::array<uint8_t, 8> ring = {};
+    receive_calls = 0UL;
+    usart1.start(ring, on_receive);
+    Register_file::set_hook(usart1_sr, sr_hook);
+    Register_file::set_hook(usart1_dr, dr_hook);
+
+    /* Nothing is reported without an idle line. */
+    usart1.handle_interrupt();
+    BMPP_CHECK_EQUAL(receive_calls, 0UL);
+
+    /* SR, then DR, is read to clear the flag before reporting. */
+    Register_file::write(usart1_sr, idle);
+    sr_read = false;
+    usart1.handle_interrupt();
+    BMPP_CHECK_EQUAL(receive_calls, 1UL);
+    BMPP_CHECK_EQUAL(Register_file::read(usart1_sr) & idle, 0UL);
+
+    Register_file::set_hook(usart1_sr, nullptr);
+    Register_file::set_hook(usart1_dr, nullptr);
+    usart1.stop();
+}
+
+void test_write() {
+    host::test::reset();
+    std::array<uint8_t, 4> data = { 1U, 2U, 3U, 4U };
+    sent_calls = 0UL;
+
+    Register_file::write(usart1_sr, tc);
+    BMPP_CHECK(usart1.write(data, on_sent));
+    BMPP_CHECK(usart1.is_writing());
+    BMPP_CHECK_EQUAL(Register_file::read(cndtr4), 4UL);
+    BMPP_CHECK_EQUAL(Register_file::read(usart1_sr) & tc, 0UL);
+
+    /* A transmission keeps its buffer until sent. */
+    BMPP_CHECK(!usart1.write(data, on_sent));
+    BMPP_CHECK_EQUAL(Register_file::read(cndtr4), 4UL);
+
+    Register_file::write(cndtr4, 0UL);
+    Register_file::write(dma_isr, tcif4 | (1UL << 12UL));
+    stm32f10xxx::dma1_channel4_handler();
+    Register_file::write(dma_isr, 0UL);
+    BMPP_CHECK_EQUAL(sent_calls, 1UL);
+    BMPP_CHECK(!usart1.is_writing());
+    BMPP_CHECK(usart1.write(data));
+    BMPP_CHECK_EQUAL(Register_file::read(cndtr4), 4UL);
+}
+
+void test_stop() {
+    host::test::reset();
+    std::array<uint8_t, 8> ring = {};
+    std::array<uint8_t, 2> data = {};
+    usart1.start(ring, on_receive);
+    BMPP_CHECK(usart1.write(data));
+
+    /* Both transfers are aborted and the interrupt disabled. */
+    usart1.stop();
+    BMPP_CHECK_EQUAL(Register_file::read(usart1_cr1), 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(usart1_cr3), 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(ccr5) & 1UL, 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(ccr4) & 1UL, 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(nvic_icer1) & usart1_irq, usart1_irq);
+    BMPP_CHECK(!usart1.is_writing());
+}
+
+} /* namespace */
+
+int main() {
+    test_baud();
+    test_ring();
+    test_idle();
+    test_write();
+    test_stop();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/
@@ -0,0 +1,219 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file    test_waveform.cpp
+ * @author  T. Verloop <t93.verloop@gmail.com>
+ * @version 0.1
+ * @date    17-10-2026
+ * @brief   Update rates of the timer driver, single plays and streams of the
+ *          waveform driver.
+ */
+
+/* System. */
+#include <array>            /* Buffers. */
+
+/* Third-party. */
+
+/* Local. */
+#include "host_test.hpp"
+#include "gpio.hpp"
+#include "timer.hpp"
+#include "waveform.hpp"
+
+namespace bmpp {
+
+namespace hal {
+
+namespace stm32f10xxx {
+
+/**
+ *  DMA1 channel 2 handler of the driver, outside the vector table.
+ */
+void dma1_channel2_handler();
+
+} /* namespace stm32f10xxx */
+
+} /* namespace hal */
+
+} /* namespace bmpp */
+
+using namespace bmpp::hal;
+using bmpp::hal::host::Register_file;
+using Waveform = bmpp::hal::stm32f10xxx::Waveform;
+
+namespace {
+
+const uint32_t tim2_cr1 = 0x4000'0000UL;    /**< TIM2 control 1.                */
+const uint32_t tim2_dier = 0x4000'000CUL;   /**< TIM2 DMA/interrupt enable.     */
+const uint32_t tim2_egr = 0x4000'0014UL;    /**< TIM2 event generation.         */
+const uint32_t tim2_cnt = 0x4000'0024UL;    /**< TIM2 counter.                  */
+const uint32_t tim2_psc = 0x4000'0028UL;    /**< TIM2 prescaler.                */
+const uint32_t tim2_arr = 0x4000'002CUL;    /**< TIM2 reload.                   */
+const uint32_t rcc_apb1enr = 0x4002'101CUL; /**< APB1 peripheral clocks.        */
+const uint32_t dma_isr = 0x4002'0000UL;     /**< Interrupt status.              */
+const uint32_t ccr2 = 0x4002'001CUL;        /**< Channel 2 configuration.       */
+const uint32_t cndtr2 = 0x4002'0020UL;      /**< Channel 2 number of data.      */
+const uint32_t cpar2 = 0x4002'0024UL;       /**< Channel 2 peripheral address.  */
+const uint32_t gpioa_bsrr = 0x4001'0810UL;  /**< Port A bit set/reset.          */
+
+const uint32_t cen = (1UL << 0UL);          /**< CR1 counter enable.            */
+const uint32_t urs = (1UL << 2UL);          /**< CR1 update request source.     */
+const uint32_t ude = (1UL << 8UL);          /**< DIER update DMA request.       */
+const uint32_t gif2 = (1UL << 4UL);         /**< Channel 2 any event.           */
+const uint32_t tcif2 = (1UL << 5UL);        /**< Channel 2 complete.            */
+const uint32_t htif2 = (1UL << 6UL);        /**< Channel 2 half transfer.       */
+const uint32_t teif2 = (1UL << 7UL);        /**< Channel 2 transfer error.      */
+
+constexpr Waveform waveform(tim2);          /**< Waveform paced by TIM2.        */
+
+uint32_t* refilled;                         /**< Last refilled half.            */
+uint16_t refill_count;                      /**< Words of the last refill.      */
+uint32_t refill_calls;                      /**< Number of refills.             */
+
+void refill(uint32_t* words, const uint16_t& count) {
+    refilled = words;
+    refill_count = count;
+    refill_calls++;
+}
+
+/**
+ *  Raises the DMA interrupt of the update channel with the given status.
+ *  @param[in]  flags   Channel 2 flags of the interrupt status.
+ *  @return None.
+ */
+void dma_event(const uint32_t& flags) {
+    Register_file::write(dma_isr, flags | gif2);
+    stm32f10xxx::dma1_channel2_handler();
+    Register_file::write(dma_isr, 0UL);
+}
+
+void test_rate() {
+    host::test::reset();
+    /* The timers run at the 8 MHz HSI after reset. */
+    BMPP_CHECK_EQUAL(tim2.get_clock(), 8'000'000UL);
+    tim2.initialize();
+    BMPP_CHECK_EQUAL(Register_file::read(rcc_apb1enr) & 1UL, 1UL);
+
+    BMPP_CHECK(tim2.set_rate(1000UL));
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_psc), 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_arr), 7999UL);
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_egr), 1UL);
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_cr1), urs);
+    BMPP_CHECK_EQUAL(tim2.get_rate(), 1000UL);
+
+    /* The smallest prescaler keeps the reload within 16 bits. */
+    BMPP_CHECK(tim2.set_rate(100UL));
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_psc), 1UL);
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_arr), 39999UL);
+    BMPP_CHECK_EQUAL(tim2.get_rate(), 100UL);
+
+    BMPP_CHECK(tim2.set_rate(4'000'000UL));
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_arr), 1UL);
+    BMPP_CHECK(!tim2.set_rate(8'000'000UL));
+    BMPP_CHECK(!tim2.set_rate(0UL));
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_arr), 1UL);
+    BMPP_CHECK(tim2.set_rate(1UL));
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_psc), 122UL);
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_arr), 65039UL);
+
+    Register_file::write(tim2_cnt, 123UL);
+    tim2.start();
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_cnt), 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_cr1), urs | cen);
+    tim2.set_update_dma(true);
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_dier), ude);
+    tim2.set_update_dma(false);
+    tim2.stop();
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_dier), 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_cr1), urs);
+}
+
+void test_play() {
+    host::test::reset();
+    const std::array<uint32_t, 3> words = {
+        Waveform::word(0x0001UL, 0x0002UL),
+        Waveform::word(0x0002UL, 0x0001UL),
+        Waveform::word(0x0000UL, 0x0003UL)
+    };
+    BMPP_CHECK_EQUAL(words[0], 0x0002'0001UL);
+    /* The port applies set over clear when both are written. */
+    BMPP_CHECK_EQUAL(Waveform::word(0x0001UL, 0x0001UL), 0x0001'0001UL);
+
+    BMPP_CHECK(!waveform.play(gpio_a, words, 8'000'000UL));
+    BMPP_CHECK(!waveform.is_playing());
+
+    BMPP_CHECK(waveform.play(gpio_a, words, 1000UL));
+    BMPP_CHECK(waveform.is_playing());
+    BMPP_CHECK_EQUAL(Register_file::read(cndtr2), 3UL);
+    BMPP_CHECK_EQUAL(Register_file::read(cpar2), gpioa_bsrr);
+    BMPP_CHECK_EQUAL(Register_file::read(ccr2) & (1UL << 5UL), 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_dier), ude);
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_cr1) & cen, cen);
+
+    /* The timer stops once the last word has been written. */
+    Register_file::write(cndtr2, 0UL);
+    dma_event(tcif2);
+    BMPP_CHECK(!waveform.is_playing());
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_cr1) & cen, 0UL);
+
+    /* A bus error disables the channel and stops the timer as well. */
+    BMPP_CHECK(waveform.play(gpio_a, words, 1000UL));
+    Register_file::write(ccr2, Register_file::read(ccr2) & ~1UL);
+    dma_event(teif2);
+    BMPP_CHECK(!waveform.is_playing());
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_cr1) & cen, 0UL);
+    waveform.stop();
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_dier), 0UL);
+}
+
+void test_stream() {
+    host::test::reset();
+    std::array<uint32_t, 8> words = {};
+    refill_calls = 0UL;
+
+    BMPP_CHECK(!waveform.stream(gpio_a, words.data(), 7U, 1000UL, refill));
+    BMPP_CHECK(!waveform.stream(gpio_a, words.data(), 0U, 1000UL, refill));
+    BMPP_CHECK(!waveform.is_playing());
+
+    BMPP_CHECK(waveform.stream(gpio_a, words, 1000UL, refill));
+    BMPP_CHECK(waveform.is_playing());
+    BMPP_CHECK_EQUAL(Register_file::read(ccr2) & (1UL << 5UL), (1UL << 5UL));
+    BMPP_CHECK_EQUAL(Register_file::read(ccr2) & (1UL << 2UL), (1UL << 2UL));
+
+    /* The half just played is refilled while the other half plays. */
+    dma_event(htif2);
+    BMPP_CHECK_EQUAL(refill_calls, 1UL);
+    BMPP_CHECK(refilled == words.data());
+    BMPP_CHECK_EQUAL(refill_count, 4U);
+    dma_event(tcif2);
+    BMPP_CHECK_EQUAL(refill_calls, 2UL);
+    BMPP_CHECK(refilled == (words.data() + 4U));
+    BMPP_CHECK(waveform.is_playing());
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_cr1) & cen, cen);
+
+    /* Streams play until stopped. */
+    waveform.stop();
+    BMPP_CHECK(!waveform.is_playing());
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_cr1) & cen, 0UL);
+    BMPP_CHECK_EQUAL(Register_file::read(tim2_dier), 0UL);
+
+    /* Without refill the buffer repeats, without half transfer interrupts. */
+    BMPP_CHECK(waveform.stream(gpio_a, words, 1000UL, nullptr));
+    BMPP_CHECK_EQUAL(Register_file::read(ccr2) & (1UL << 2UL), 0UL);
+    dma_event(tcif2);
+    BMPP_CHECK_EQUAL(refill_calls, 2UL);
+    BMPP_CHECK(waveform.is_playing());
+    waveform.stop();
+}
+
+} /* namespace */
+
+int main() {
+    test_rate();
+    test_play();
+    test_stream();
+    return host::test::result();
+}
+
+/******************************************************************************/
+/* EOF.                                                                       */
+/******************************************************************************/